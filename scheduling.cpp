@@ -77,6 +77,42 @@ void SetProfilingEnabled(bool enabled)
   profiling_enabled = enabled;
 }
 
+bool performance_counter_profiling_enabled = false;
+
+bool IsPerformanceCounterProfilingEnabled()
+{
+  return performance_counter_profiling_enabled;
+}
+
+void SetPerformanceCounterProfilingEnabled(bool enabled)
+{
+  performance_counter_profiling_enabled = enabled;
+}
+
+bool resource_usage_profiling_enabled = false;
+
+bool IsResourceUsageProfilingEnabled()
+{
+  return resource_usage_profiling_enabled;
+}
+
+void SetResourceUsageProfilingEnabled(bool enabled)
+{
+  resource_usage_profiling_enabled = enabled;
+}
+
+bool shared_memory_telemetry_enabled = false;
+
+bool IsSharedMemoryTelemetryEnabled()
+{
+  return shared_memory_telemetry_enabled;
+}
+
+void SetSharedMemoryTelemetryEnabled(bool enabled)
+{
+  shared_memory_telemetry_enabled = enabled;
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -61,6 +61,21 @@ namespace scheduling
  */
 bool IsProfilingEnabled();
 
+/*!
+ * \return True if performance counter profiling is enabled (false by default)
+ */
+bool IsPerformanceCounterProfilingEnabled();
+
+/*!
+ * \return True if resource usage profiling is enabled (false by default)
+ */
+bool IsResourceUsageProfilingEnabled();
+
+/*!
+ * \return True if shared memory telemetry is enabled (false by default)
+ */
+bool IsSharedMemoryTelemetryEnabled();
+
 /*!
  * Sets whether profiling should be enabled.
  * This creates additional ports containing information about execution
@@ -72,6 +87,45 @@ bool IsProfilingEnabled();
  */
 void SetProfilingEnabled(bool enabled);
 
+/*!
+ * Sets whether profiling should additionally measure CPU cycles, instructions,
+ * cache misses and branch misses of each task execution using hardware
+ * performance counters (see tPerformanceCounters and tTaskProfile).
+ * Falls back to software counters if hardware counters are not available.
+ * It adds two system calls to the execution of each task.
+ * Requires profiling to be enabled.
+ * Performance counter profiling is disabled by default.
+ * This must be set, before thread containers are started.
+ *
+ * \param Whether to enable performance counter profiling
+ */
+void SetPerformanceCounterProfilingEnabled(bool enabled);
+
+/*!
+ * Sets whether profiling should additionally measure CPU time, context switches
+ * and page faults of each task execution (see tTaskProfile).
+ * This allows telling apart preemption from actual computation.
+ * It adds four system calls to the execution of each task.
+ * Requires profiling to be enabled.
+ * Resource usage profiling is disabled by default.
+ *
+ * \param Whether to enable resource usage profiling
+ */
+void SetResourceUsageProfilingEnabled(bool enabled);
+
+/*!
+ * Sets whether thread containers should write their profiles to a POSIX
+ * shared memory segment (see tTelemetrySegment).
+ * This way, live task profiles can be inspected with external tools
+ * (e.g. finroc_scheduling_telemetry) without connecting to the runtime.
+ * Requires profiling to be enabled.
+ * Shared memory telemetry is disabled by default.
+ * This must be set, before thread containers are started.
+ *
+ * \param Whether to enable shared memory telemetry
+ */
+void SetSharedMemoryTelemetryEnabled(bool enabled);
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -0,0 +1,111 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tBackgroundJob.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tBackgroundJob
+ *
+ * \b tBackgroundJob
+ *
+ * Interface for low-priority background work that a thread container
+ * executes in the idle time (slack) at the end of its cycles.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tBackgroundJob_h__
+#define __plugins__scheduling__tBackgroundJob_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include "rrlib/time/time.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Background job
+/*!
+ * Low-priority background work (e.g. log compression or map maintenance) that a thread container
+ * executes in slices in the idle time (slack) after its tasks have been executed in a cycle
+ * (see tThreadContainerElement::AddBackgroundJob()).
+ *
+ * Preemption is cooperative: a slice must return as soon as possible after the deadline
+ * it is passed - so that the next cycle can start on time.
+ */
+class tBackgroundJob : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  virtual ~tBackgroundJob() {}
+
+  /*!
+   * Executes a slice of background work.
+   * Work should be split up into small steps - and the deadline should be checked after each of them.
+   *
+   * \param deadline Time at which slice must return (application time)
+   * \return Whether job has more work to do (if false, job is removed from thread container)
+   */
+  virtual bool ExecuteSlice(const rrlib::time::tTimestamp& deadline) = 0;
+
+  /*!
+   * \param deadline Deadline passed to ExecuteSlice()
+   * \return Whether the current slice should return, because its deadline has passed
+   */
+  static bool ShouldYield(const rrlib::time::tTimestamp& deadline)
+  {
+    return rrlib::time::Now(true) >= deadline;
+  }
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
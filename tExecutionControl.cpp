@@ -63,6 +63,9 @@ namespace scheduling
 // Const values
 //----------------------------------------------------------------------
 
+/*! Delay between preparing controls and their common start time (if no start time is specified in StartAll()) - so that all controls are released before */
+const rrlib::time::tDuration cSTART_DELAY = std::chrono::milliseconds(2);
+
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
@@ -96,26 +99,41 @@ void tExecutionControl::PauseAll(core::tFrameworkElement& fe)
 {
   std::vector<tExecutionControl*> ecs;
   FindAll(ecs, fe);
+  std::vector<tExecutionControl*> pausing;
   for (auto it = ecs.begin(); it < ecs.end(); it++)
   {
     if ((*it)->IsRunning())
     {
-      (*it)->Pause();
+      (*it)->RequestPause();
+      pausing.push_back(*it);
     }
   }
+  for (auto it = pausing.begin(); it < pausing.end(); it++)
+  {
+    (*it)->WaitUntilPaused();
+  }
 }
 
-void tExecutionControl::StartAll(core::tFrameworkElement& fe)
+void tExecutionControl::StartAll(core::tFrameworkElement& fe, const rrlib::time::tTimestamp& start_time)
 {
   std::vector<tExecutionControl*> ecs;
   FindAll(ecs, fe);
+  std::vector<tExecutionControl*> starting;
   for (auto it = ecs.begin(); it < ecs.end(); it++)
   {
     if (!(*it)->IsRunning())
     {
-      (*it)->Start();
+      (*it)->PrepareStart();
+      starting.push_back(*it);
     }
   }
+
+  // Release all controls with common start time (each control waits for its start time itself)
+  rrlib::time::tTimestamp base_time = start_time == rrlib::time::cNO_TIME ? rrlib::time::Now(true) + cSTART_DELAY : start_time;
+  for (auto it = starting.begin(); it < starting.end(); it++)
+  {
+    (*it)->StartAt(base_time + (*it)->GetPhaseOffset());
+  }
 }
 
 //----------------------------------------------------------------------
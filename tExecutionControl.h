@@ -92,6 +92,14 @@ public:
    */
   static void FindAll(std::vector<tExecutionControl*>& result, core::tFrameworkElement& fe);
 
+  /*!
+   * \return Offset of first cycle relative to common start time when started synchronized with other elements
+   */
+  inline rrlib::time::tDuration GetPhaseOffset()
+  {
+    return implementation.GetPhaseOffset();
+  }
+
   /*!
    * \return Is currently executing?
    */
@@ -109,12 +117,30 @@ public:
   }
 
   /*!
-   * Pauses all execution controls below and possibly attached to specified element
+   * Pauses all execution controls below and possibly attached to specified element.
+   * All controls are signalled first - and then joined. So pausing takes as long
+   * as the slowest control - not the sum of all.
    *
    * \param fe Framework element that is root of subtree to search for execution controls
    */
   static void PauseAll(core::tFrameworkElement& fe);
 
+  /*!
+   * Prepare starting execution (see tStartAndPausable::PrepareExecution())
+   */
+  inline void PrepareStart()
+  {
+    implementation.PrepareExecution();
+  }
+
+  /*!
+   * Requests pausing execution - without blocking (see tStartAndPausable::RequestPause())
+   */
+  inline void RequestPause()
+  {
+    implementation.RequestPause();
+  }
+
   /*!
    * Start/Resume execution
    */
@@ -124,11 +150,32 @@ public:
   }
 
   /*!
-   * Starts all execution controls below and possibly attached to specified element
+   * Start/Resume execution with first cycle beginning at specified time (see tStartAndPausable::StartExecutionAt())
+   */
+  inline void StartAt(const rrlib::time::tTimestamp& start_time)
+  {
+    implementation.StartExecutionAt(start_time);
+  }
+
+  /*!
+   * Starts all execution controls below and possibly attached to specified element.
+   * All controls are prepared first. Then, all of them are released with the same start time:
+   * each control begins its first cycle at start time plus its configured phase offset (see GetPhaseOffset()) -
+   * independent of the order and time at which they are released. So skew does not grow with the number of controls.
+   * Controls without a phase offset begin cycles at the same instant.
    *
    * \param fe Framework element that is root of subtree to search for execution controls
+   * \param start_time Time at which to start execution (with phase offset 0). If no time is specified, controls are started shortly after they are prepared.
+   */
+  static void StartAll(core::tFrameworkElement& fe, const rrlib::time::tTimestamp& start_time = rrlib::time::cNO_TIME);
+
+  /*!
+   * Blocks until execution has paused after RequestPause() was called
    */
-  static void StartAll(core::tFrameworkElement& fe);
+  inline void WaitUntilPaused()
+  {
+    implementation.WaitUntilPaused();
+  }
 
 //----------------------------------------------------------------------
 // Private fields and methods
@@ -0,0 +1,276 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tFlightRecorder.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tFlightRecorder.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <fstream>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Cycle time of flight recorder thread (only checks for pending dumps) */
+const rrlib::time::tDuration cDUMP_CHECK_INTERVAL = std::chrono::milliseconds(100);
+
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * \param string String to write to JSON file
+ * \return String with special characters escaped
+ */
+static std::string EscapeJson(const std::string& string)
+{
+  std::string result;
+  for (char c : string)
+  {
+    if (c == '"' || c == '\\')
+    {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result;
+}
+
+tFlightRecorder::tFlightRecorder(const std::string& container_name, size_t cycle_count, double overrun_threshold, const std::string& dump_directory) :
+  tLoopThread(cDUMP_CHECK_INTERVAL, false, false),
+  container_name(container_name),
+  overrun_threshold(overrun_threshold),
+  dump_directory(dump_directory),
+  cycle_records(cycle_count + 1),  // one slot for cycle in progress
+  task_records(),
+  max_task_count(0),
+  recorded_cycle_count(0),
+  current_cycle_index(0),
+  pending_dump_reason(nullptr),
+  dump_requested(false),
+  schedules(),
+  task_count(0),
+  current_cycle_to_dump(-1),
+  cycle_time(0),
+  mutex()
+{
+  this->SetName("Flight Recorder for " + container_name);
+}
+
+bool tFlightRecorder::BeginCycle(const rrlib::time::tTimestamp& cycle_start, const rrlib::time::tDuration& wake_up_latency, uint32_t schedule_version)
+{
+  if (pending_dump_reason.load(std::memory_order_acquire))
+  {
+    return false;
+  }
+  current_cycle_index = recorded_cycle_count.load(std::memory_order_relaxed) % cycle_records.size();
+  tCycleRecord& record = cycle_records[current_cycle_index];
+  record.cycle_start = cycle_start;
+  record.wake_up_latency = wake_up_latency;
+  record.duration = rrlib::time::tDuration::zero();
+  record.schedule_version = schedule_version;
+  record.task_count = static_cast<uint32_t>(std::min(task_count, max_task_count));
+  std::fill(task_records.begin() + current_cycle_index * max_task_count, task_records.begin() + (current_cycle_index + 1) * max_task_count, tTaskRecord { -1, 0 });
+  return true;
+}
+
+void tFlightRecorder::EndCycle(const rrlib::time::tDuration& duration, const rrlib::time::tDuration& cycle_time)
+{
+  cycle_records[current_cycle_index].duration = duration;
+  this->cycle_time = cycle_time;
+  recorded_cycle_count.store(recorded_cycle_count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+  if (overrun_threshold >= 0 && cycle_time > rrlib::time::tDuration::zero() && duration.count() > cycle_time.count() * (1.0 + overrun_threshold))
+  {
+    TriggerDump("cycle overrun");
+  }
+  if (dump_requested.load(std::memory_order_relaxed))
+  {
+    dump_requested.store(false, std::memory_order_relaxed);
+    TriggerDump("manual request");
+  }
+}
+
+void tFlightRecorder::MainLoopCallback()
+{
+  const char* reason = pending_dump_reason.load(std::memory_order_acquire);
+  if (reason)
+  {
+    WriteDump(reason);
+    pending_dump_reason.store(nullptr, std::memory_order_release);
+  }
+}
+
+void tFlightRecorder::SetSchedule(uint32_t schedule_version, const std::vector<std::string>& task_names, const std::vector<core::tFrameworkElement::tHandle>& task_handles)
+{
+  rrlib::thread::tLock lock(mutex);
+  task_count = task_names.size();
+  if (task_names.size() > max_task_count)
+  {
+    // Previously recorded cycles are discarded
+    max_task_count = task_names.size();
+    task_records.assign(max_task_count * cycle_records.size(), tTaskRecord { -1, 0 });
+    recorded_cycle_count.store(0, std::memory_order_release);
+    schedules.clear();
+  }
+
+  // Remove schedules that no recorded cycle refers to any more
+  uint64_t recorded_cycle_count = this->recorded_cycle_count.load(std::memory_order_relaxed);
+  if (recorded_cycle_count == 0)
+  {
+    schedules.clear();
+  }
+  else
+  {
+    uint64_t oldest_cycle = recorded_cycle_count - std::min<uint64_t>(recorded_cycle_count, cycle_records.size() - 1);
+    uint32_t oldest_version = cycle_records[oldest_cycle % cycle_records.size()].schedule_version;
+    schedules.erase(schedules.begin(), std::find_if(schedules.begin(), schedules.end(), [oldest_version](const tSchedule & schedule)
+    {
+      return schedule.version >= oldest_version;
+    }));
+  }
+  schedules.push_back(tSchedule { schedule_version, task_names, task_handles });
+}
+
+void tFlightRecorder::TriggerDump(const char* reason, bool include_current_cycle)
+{
+  const char* expected = nullptr;
+  if (include_current_cycle)
+  {
+    current_cycle_to_dump.store(recorded_cycle_count.load(std::memory_order_acquire), std::memory_order_relaxed);
+  }
+  if ((!pending_dump_reason.compare_exchange_strong(expected, reason, std::memory_order_acq_rel)) && include_current_cycle)
+  {
+    // another dump is already pending (and may be written already)
+    current_cycle_to_dump.store(-1, std::memory_order_relaxed);
+  }
+}
+
+void tFlightRecorder::WriteDump(const char* reason)
+{
+  // Copy recorded data (file is written without holding the lock - so that rescheduling container thread never waits for file I/O)
+  std::vector<tCycleRecord> cycles;
+  std::vector<tTaskRecord> tasks;
+  std::vector<tSchedule> schedules;
+  size_t max_task_count = 0;
+  bool current_cycle_included = false;
+  rrlib::time::tDuration cycle_time;
+  rrlib::time::tTimestamp dump_time = rrlib::time::Now();
+  {
+    rrlib::thread::tLock lock(mutex);
+    uint64_t recorded_cycle_count = this->recorded_cycle_count.load(std::memory_order_acquire);
+    uint64_t cycle_count = std::min<uint64_t>(recorded_cycle_count, cycle_records.size() - 1);
+    uint64_t current_cycle = current_cycle_to_dump.exchange(-1, std::memory_order_relaxed);
+    current_cycle_included = current_cycle == recorded_cycle_count;  // cycle has not been completed yet
+    for (uint64_t cycle = recorded_cycle_count - cycle_count; cycle < recorded_cycle_count + (current_cycle_included ? 1 : 0); cycle++)
+    {
+      size_t index = cycle % cycle_records.size();
+      cycles.push_back(cycle_records[index]);
+      tasks.insert(tasks.end(), task_records.begin() + index * this->max_task_count, task_records.begin() + (index + 1) * this->max_task_count);
+    }
+    schedules = this->schedules;
+    max_task_count = this->max_task_count;
+    cycle_time = this->cycle_time;
+  }
+
+  std::string file_name = dump_directory + "/flight_recorder_" + container_name + "_" + rrlib::time::ToIsoString(dump_time) + ".json";
+  std::replace(file_name.begin() + dump_directory.length() + 1, file_name.end(), '/', '_');
+  std::ofstream file(file_name);
+  if (!file)
+  {
+    FINROC_LOG_PRINT(ERROR, "Could not write flight recorder dump to '", file_name, "'");
+    return;
+  }
+
+  // Tasks are written as [start offset, duration] in nanoseconds. Tasks that were not executed have a start offset of -1.
+  // Cycle currently being executed is only included on watchdog alert (marked with "in_progress" - stuck task has a duration of -1; duration of cycle is time elapsed until dump).
+  // Task names of each cycle are found in the schedule with the cycle's schedule version.
+  file << "{\n  \"container\": \"" << EscapeJson(container_name) << "\",\n  \"reason\": \"" << reason << "\",\n  \"cycle_time_ns\": " << cycle_time.count()
+       << ",\n  \"schedule_version\": " << (schedules.empty() ? 0 : schedules.back().version) << ",\n  \"schedules\": [";
+  for (size_t i = 0; i < schedules.size(); i++)
+  {
+    file << (i ? ",\n" : "\n") << "    { \"version\": " << schedules[i].version << ", \"tasks\": [";
+    for (size_t j = 0; j < schedules[i].task_names.size(); j++)
+    {
+      file << (j ? ",\n" : "\n") << "      { \"handle\": " << schedules[i].task_handles[j] << ", \"name\": \"" << EscapeJson(schedules[i].task_names[j]) << "\" }";
+    }
+    file << "\n    ] }";
+  }
+  file << "\n  ],\n  \"cycles\": [";
+  for (size_t cycle = 0; cycle < cycles.size(); cycle++)
+  {
+    const tCycleRecord& record = cycles[cycle];
+    bool in_progress = current_cycle_included && cycle == cycles.size() - 1;
+    rrlib::time::tDuration duration = in_progress ? dump_time - record.cycle_start : record.duration;
+    file << (cycle ? ",\n" : "\n") << "    { \"start_ns\": " << record.cycle_start.time_since_epoch().count()
+         << ", \"wake_up_latency_ns\": " << record.wake_up_latency.count() << ", \"duration_ns\": " << duration.count()
+         << ", \"schedule_version\": " << record.schedule_version << (in_progress ? ", \"in_progress\": true" : "") << ", \"tasks\": [";
+    for (size_t i = 0; i < record.task_count; i++)
+    {
+      const tTaskRecord& task_record = tasks[cycle * max_task_count + i];
+      file << (i ? ", " : "") << "[" << task_record.start_offset << ", " << task_record.duration << "]";
+    }
+    file << "] }";
+  }
+  file << "\n  ]\n}\n";
+  FINROC_LOG_PRINT(WARNING, "Wrote flight recorder dump (", reason, ") with ", cycles.size(), " cycles to '", file_name, "'");
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
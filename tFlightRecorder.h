@@ -0,0 +1,288 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tFlightRecorder.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tFlightRecorder
+ *
+ * \b tFlightRecorder
+ *
+ * Flight recorder for a thread container.
+ * Keeps the timing of the last N cycles in a fixed-size, preallocated ring buffer
+ * and writes it to a JSON file when a trigger fires (cycle overrun, watchdog alert
+ * or manual request). This allows debugging rare timing spikes in the field
+ * that continuous tracing is too expensive to catch.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tFlightRecorder_h__
+#define __plugins__scheduling__tFlightRecorder_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLoopThread.h"
+#include "core/tFrameworkElement.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Flight recorder for thread container
+/*!
+ * Flight recorder for a thread container.
+ * Keeps the timing of the last N cycles in a fixed-size, preallocated ring buffer
+ * and writes it to a JSON file when a trigger fires (cycle overrun, watchdog alert
+ * or manual request).
+ *
+ * Recording is performed by the container thread (without locking or allocating memory).
+ * When a trigger fires, recording is paused and the flight recorder's own low-priority
+ * thread writes the file. Afterwards, recording continues.
+ */
+class tFlightRecorder : public rrlib::thread::tLoopThread
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param container_name Name of thread container (used in thread and file names)
+   * \param cycle_count Number of completed cycles to keep in ring buffer (and include in dumps) - an additional slot is used for the cycle in progress
+   * \param overrun_threshold Dump is triggered when the execution of a cycle exceeds the cycle time by this fraction (e.g. 0.5 for 50%) - negative values disable this trigger
+   * \param dump_directory Directory to write dump files to
+   */
+  tFlightRecorder(const std::string& container_name, size_t cycle_count, double overrun_threshold, const std::string& dump_directory);
+
+  /*!
+   * Begins recording a new cycle (may only be called by container thread)
+   *
+   * \param cycle_start Start time of cycle
+   * \param wake_up_latency Delay between planned cycle start and actual start of task execution
+   * \param schedule_version Version of schedule that is executed
+   * \return Whether cycle is recorded (false while a dump is pending)
+   */
+  bool BeginCycle(const rrlib::time::tTimestamp& cycle_start, const rrlib::time::tDuration& wake_up_latency, uint32_t schedule_version);
+
+  /*!
+   * Ends recording the current cycle and checks overrun trigger (may only be called by container thread)
+   *
+   * \param duration Execution duration of cycle
+   * \param cycle_time Current cycle time of thread container
+   */
+  void EndCycle(const rrlib::time::tDuration& duration, const rrlib::time::tDuration& cycle_time);
+
+  virtual void MainLoopCallback() override;
+
+  /*!
+   * Requests dump of recorded cycles (can be called from any thread).
+   * The dump is triggered at the end of the container's current cycle.
+   */
+  void RequestDump()
+  {
+    dump_requested.store(true, std::memory_order_relaxed);
+  }
+
+  /*!
+   * Records start of task in current cycle (may only be called by container thread - between BeginCycle() and EndCycle()).
+   * Until SetTaskTiming() is called, the task is marked as running (so that a task that got stuck appears in a watchdog dump).
+   *
+   * \param index Index of task in execution plan
+   * \param start_offset Start time of task relative to start of cycle
+   */
+  void SetTaskStart(size_t index, const rrlib::time::tDuration& start_offset)
+  {
+    if (index < max_task_count)
+    {
+      tTaskRecord& record = task_records[current_cycle_index * max_task_count + index];
+      record.start_offset = start_offset.count();
+      record.duration = -1;
+    }
+  }
+
+  /*!
+   * Records timing of task in current cycle (may only be called by container thread - between BeginCycle() and EndCycle())
+   *
+   * \param index Index of task in execution plan
+   * \param start_offset Start time of task relative to start of cycle
+   * \param duration Execution duration of task
+   */
+  void SetTaskTiming(size_t index, const rrlib::time::tDuration& start_offset, const rrlib::time::tDuration& duration)
+  {
+    if (index < max_task_count)
+    {
+      tTaskRecord& record = task_records[current_cycle_index * max_task_count + index];
+      record.start_offset = start_offset.count();
+      record.duration = duration.count();
+    }
+  }
+
+  /*!
+   * Sets information on the tasks in the current schedule (called by container thread whenever rescheduling).
+   * Allocates memory (names are kept for every schedule version that recorded cycles refer to).
+   *
+   * \param schedule_version Version of new schedule
+   * \param task_names Names of tasks in schedule (in order of execution)
+   * \param task_handles Handles of tasks in schedule (in order of execution)
+   */
+  void SetSchedule(uint32_t schedule_version, const std::vector<std::string>& task_names, const std::vector<core::tFrameworkElement::tHandle>& task_handles);
+
+  /*!
+   * Triggers dump of recorded cycles (can be called from any thread, e.g. watchdog)
+   * No further cycles are recorded until the dump has been written.
+   *
+   * \param reason Reason for dump (is written to file - must be string literal)
+   * \param include_current_cycle Whether to include the cycle currently being executed (e.g. on watchdog alert - as it contains the stuck task)
+   */
+  void TriggerDump(const char* reason, bool include_current_cycle = false);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Information on one recorded cycle */
+  struct tCycleRecord
+  {
+    /*! Start time of cycle */
+    rrlib::time::tTimestamp cycle_start;
+
+    /*! Delay between planned cycle start and actual start of task execution */
+    rrlib::time::tDuration wake_up_latency;
+
+    /*! Execution duration of cycle */
+    rrlib::time::tDuration duration;
+
+    /*! Version of schedule that was executed */
+    uint32_t schedule_version;
+
+    /*! Number of tasks in schedule */
+    uint32_t task_count;
+  };
+
+  /*! Names and handles of tasks in one version of the schedule */
+  struct tSchedule
+  {
+    /*! Version of schedule */
+    uint32_t version;
+
+    /*! Names of tasks in schedule */
+    std::vector<std::string> task_names;
+
+    /*! Handles of tasks in schedule */
+    std::vector<core::tFrameworkElement::tHandle> task_handles;
+  };
+
+  /*! Timing of one task in recorded cycle (in nanoseconds) */
+  struct tTaskRecord
+  {
+    /*! Start time of task relative to start of cycle */
+    int64_t start_offset;
+
+    /*! Execution duration of task */
+    int64_t duration;
+  };
+
+  /*! Name of thread container */
+  std::string container_name;
+
+  /*! Dump is triggered when the execution of a cycle exceeds the cycle time by this fraction */
+  double overrun_threshold;
+
+  /*! Directory to write dump files to */
+  std::string dump_directory;
+
+  /*! Ring buffer with recorded cycles (completed cycles - plus one slot for the cycle in progress) */
+  std::vector<tCycleRecord> cycle_records;
+
+  /*! Task timings of recorded cycles (max_task_count entries per cycle - same index as in cycle_records) */
+  std::vector<tTaskRecord> task_records;
+
+  /*! Maximum number of tasks per cycle that can be recorded with currently allocated memory */
+  size_t max_task_count;
+
+  /*! Number of completely recorded cycles */
+  std::atomic<uint64_t> recorded_cycle_count;
+
+  /*! Index of cycle currently being recorded in cycle_records */
+  size_t current_cycle_index;
+
+  /*! Reason for pending dump - nullptr if no dump is pending (recording is paused while dump is pending) */
+  std::atomic<const char*> pending_dump_reason;
+
+  /*! Has dump been requested manually? */
+  std::atomic<bool> dump_requested;
+
+  /*!
+   * Current and older schedules that recorded cycles refer to (in ascending order of version - current schedule is last).
+   * Older schedules are removed once no recorded cycle refers to them any more.
+   */
+  std::vector<tSchedule> schedules;
+
+  /*! Number of tasks in current schedule */
+  size_t task_count;
+
+  /*! Number of cycle (see recorded_cycle_count) that is being executed when dump including the current cycle is triggered - -1 if it is not to be included */
+  std::atomic<uint64_t> current_cycle_to_dump;
+
+  /*! Cycle time of thread container (as passed to last EndCycle() call) */
+  rrlib::time::tDuration cycle_time;
+
+  /*! Mutex for schedule information and memory allocation (ensures that data is not copied for dump while memory is reallocated - file is written without lock) */
+  rrlib::thread::tMutex mutex;
+
+  /*!
+   * Writes dump file
+   *
+   * \param reason Reason for dump
+   */
+  void WriteDump(const char* reason);
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,191 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tPerformanceCounters.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tPerformanceCounters.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "core/tFrameworkElement.h"
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+#ifdef __linux__
+
+/*!
+ * Opens performance counter for calling thread
+ *
+ * \param type Type of counter (e.g. PERF_TYPE_HARDWARE)
+ * \param config Counter (e.g. PERF_COUNT_HW_CPU_CYCLES)
+ * \param group_fd File descriptor of group leader (-1 to open group leader)
+ * \return File descriptor (-1 if counter could not be opened)
+ */
+static int OpenCounter(uint32_t type, uint64_t config, int group_fd)
+{
+  perf_event_attr attributes;
+  memset(&attributes, 0, sizeof(attributes));
+  attributes.type = type;
+  attributes.size = sizeof(attributes);
+  attributes.config = config;
+  attributes.disabled = group_fd == -1 ? 1 : 0;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  attributes.read_format = PERF_FORMAT_GROUP;
+  return static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, group_fd, 0));
+}
+
+#endif
+
+tPerformanceCounters::tPerformanceCounters() :
+  counter_count(0),
+  hardware_counters(false)
+{
+  for (int i = 0; i < cCOUNTER_COUNT; i++)
+  {
+    file_descriptors[i] = -1;
+    value_index[i] = -1;
+  }
+}
+
+tPerformanceCounters::~tPerformanceCounters()
+{
+  Close();
+}
+
+void tPerformanceCounters::Close()
+{
+  for (int i = 0; i < cCOUNTER_COUNT; i++)
+  {
+    if (file_descriptors[i] != -1)
+    {
+      close(file_descriptors[i]);
+      file_descriptors[i] = -1;
+    }
+    value_index[i] = -1;
+  }
+  counter_count = 0;
+}
+
+bool tPerformanceCounters::Open()
+{
+  Close();
+#ifdef __linux__
+  const uint64_t cHARDWARE_COUNTERS[cCOUNTER_COUNT] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+  file_descriptors[0] = OpenCounter(PERF_TYPE_HARDWARE, cHARDWARE_COUNTERS[0], -1);
+  hardware_counters = file_descriptors[0] != -1;
+  if (hardware_counters)
+  {
+    value_index[0] = counter_count++;
+    for (int i = 1; i < cCOUNTER_COUNT; i++)
+    {
+      file_descriptors[i] = OpenCounter(PERF_TYPE_HARDWARE, cHARDWARE_COUNTERS[i], file_descriptors[0]);
+      if (file_descriptors[i] != -1)
+      {
+        value_index[i] = counter_count++;
+      }
+    }
+  }
+  else
+  {
+    file_descriptors[0] = OpenCounter(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK, -1);
+    if (file_descriptors[0] == -1)
+    {
+      FINROC_LOG_PRINT(WARNING, "Could not open performance counters: ", strerror(errno));
+      return false;
+    }
+    value_index[0] = counter_count++;
+    FINROC_LOG_PRINT(WARNING, "Hardware performance counters are not available. Using software counters (cycles are approximated by CPU clock in nanoseconds).");
+  }
+  ioctl(file_descriptors[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(file_descriptors[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void tPerformanceCounters::Read(tValues& values)
+{
+  uint64_t data[cCOUNTER_COUNT + 1] = { 0 };  // number of counters, followed by values
+  if (counter_count == 0 || read(file_descriptors[0], data, sizeof(data)) <= 0)
+  {
+    data[0] = 0;
+  }
+  uint64_t* counter_values[cCOUNTER_COUNT] = { &values.cycles, &values.instructions, &values.cache_misses, &values.branch_misses };
+  for (int i = 0; i < cCOUNTER_COUNT; i++)
+  {
+    *counter_values[i] = (value_index[i] >= 0 && static_cast<uint64_t>(value_index[i]) < data[0]) ? data[value_index[i] + 1] : 0;
+  }
+}
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,148 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tPerformanceCounters.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tPerformanceCounters
+ *
+ * \b tPerformanceCounters
+ *
+ * Hardware performance counters of a thread (Linux perf_event_open)
+ * used for profiling tasks.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tPerformanceCounters_h__
+#define __plugins__scheduling__tPerformanceCounters_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Performance counters of a thread
+/*!
+ * Opens a group of performance counters (perf_event_open) that counts the events of the calling thread
+ * in user space: CPU cycles, instructions, cache misses and branch misses.
+ * The group is read with a single read() system call.
+ *
+ * If the hardware counter for cycles is not available (e.g. in virtual machines or
+ * with restrictive perf_event_paranoid settings), software counters are used instead:
+ * cycles are then approximated by the thread's CPU clock in nanoseconds - and the other counters are zero.
+ * Other hardware counters that are not available individually are zero as well.
+ */
+class tPerformanceCounters : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Counter values */
+  struct tValues
+  {
+    uint64_t cycles, instructions, cache_misses, branch_misses;
+  };
+
+  tPerformanceCounters();
+
+  ~tPerformanceCounters();
+
+  /*!
+   * \return Whether hardware counters are used (false if software counters are used as fallback)
+   */
+  bool IsUsingHardwareCounters() const
+  {
+    return hardware_counters;
+  }
+
+  /*!
+   * Opens counters for calling thread
+   * (values should only be read by this thread)
+   *
+   * \return Whether any counters could be opened
+   */
+  bool Open();
+
+  /*!
+   * Reads current counter values (values of counters that are not available are zero)
+   *
+   * \param values Object to store values in
+   */
+  void Read(tValues& values);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  enum { cCOUNTER_COUNT = 4 };
+
+  /*! File descriptors of counters (-1 if not opened) - the first is the group leader */
+  int file_descriptors[cCOUNTER_COUNT];
+
+  /*! Index of counter values in data read from group (-1 if counter is not available) - in tValues order */
+  int value_index[cCOUNTER_COUNT];
+
+  /*! Number of counters in group */
+  int counter_count;
+
+  /*! Are hardware counters used? */
+  bool hardware_counters;
+
+  /*! Closes all counters */
+  void Close();
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -32,10 +32,14 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include "plugins/data_ports/common/tAbstractDataPort.h"
+#include <algorithm>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/scheduling/tExecutionControl.h"
+#include "plugins/scheduling/tRuntimeChangeDispatcher.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -71,12 +75,15 @@ tPeriodicFrameworkElementTask::tPeriodicFrameworkElementTask(core::tEdgeAggregat
   task(task),
   incoming(),
   outgoing(),
-  previous_tasks(),
-  next_tasks(),
-  total_execution_duration(0),
-  max_execution_duration(0),
-  execution_count(0),
-  execution_duration(execution_duration)
+  assigned_thread_container(nullptr),
+  owner(nullptr),
+  release_time(rrlib::time::cNO_TIME),
+  schedule_graph_index(-1),
+  execution_duration(execution_duration),
+  event_triggered(false),
+  triggered(false),
+  trigger_listener(*this),
+  trigger_ports()
 {
   if (incoming_ports)
   {
@@ -93,15 +100,29 @@ tPeriodicFrameworkElementTask::tPeriodicFrameworkElementTask(const std::vector<c
   task(task),
   incoming(incoming_ports),
   outgoing(outgoing_ports),
-  previous_tasks(),
-  next_tasks(),
-  total_execution_duration(0),
-  max_execution_duration(0),
-  execution_count(0),
-  execution_duration(execution_duration)
+  assigned_thread_container(nullptr),
+  owner(nullptr),
+  release_time(rrlib::time::cNO_TIME),
+  schedule_graph_index(-1),
+  execution_duration(execution_duration),
+  event_triggered(false),
+  triggered(false),
+  trigger_listener(*this),
+  trigger_ports()
 {
 }
 
+tPeriodicFrameworkElementTask::~tPeriodicFrameworkElementTask()
+{
+  DetachTriggerListener();  // annotation is deleted with runtime's structure mutex locked
+  if (assigned_thread_container)
+  {
+    rrlib::thread::tLock lock(GetMigratedTasksMutex());
+    std::vector<tPeriodicFrameworkElementTask*>& migrated_tasks = GetMigratedTasks();
+    migrated_tasks.erase(std::remove(migrated_tasks.begin(), migrated_tasks.end(), this), migrated_tasks.end());
+  }
+}
+
 std::string tPeriodicFrameworkElementTask::GetLogDescription()
 {
   core::tFrameworkElement* annotated = this->GetAnnotated<core::tFrameworkElement>();
@@ -119,6 +140,33 @@ std::string tPeriodicFrameworkElementTask::GetLogDescription()
   }
 }
 
+void tPeriodicFrameworkElementTask::HandBackMigratedTasks(core::tFrameworkElement& thread_container)
+{
+  rrlib::thread::tLock lock(thread_container.GetStructureMutex());
+  rrlib::thread::tLock lock2(GetMigratedTasksMutex());
+  std::vector<tPeriodicFrameworkElementTask*>& migrated_tasks = GetMigratedTasks();
+  for (tPeriodicFrameworkElementTask * task : migrated_tasks)
+  {
+    if (task->assigned_thread_container == &thread_container)
+    {
+      task->assigned_thread_container = nullptr;  // original thread container schedules task again
+      core::tFrameworkElement* annotated = task->GetAnnotated<core::tFrameworkElement>();
+      if (annotated)
+      {
+        tRuntimeChangeDispatcher::GetInstance().NotifyTaskMigration(*annotated, nullptr, nullptr);
+      }
+      if (task->owner.load(std::memory_order_relaxed) == &thread_container)
+      {
+        task->Release(rrlib::time::Now());
+      }
+    }
+  }
+  migrated_tasks.erase(std::remove_if(migrated_tasks.begin(), migrated_tasks.end(), [](tPeriodicFrameworkElementTask * task)
+  {
+    return !task->assigned_thread_container;
+  }), migrated_tasks.end());
+}
+
 bool tPeriodicFrameworkElementTask::IsSenseTask()
 {
   for (auto it = outgoing.begin(); it < outgoing.end(); it++)
@@ -138,6 +186,18 @@ bool tPeriodicFrameworkElementTask::IsSenseTask()
   return false;
 }
 
+std::vector<tPeriodicFrameworkElementTask*>& tPeriodicFrameworkElementTask::GetMigratedTasks()
+{
+  static std::vector<tPeriodicFrameworkElementTask*> migrated_tasks;
+  return migrated_tasks;
+}
+
+rrlib::thread::tMutex& tPeriodicFrameworkElementTask::GetMigratedTasksMutex()
+{
+  static rrlib::thread::tMutex mutex;
+  return mutex;
+}
+
 bool tPeriodicFrameworkElementTask::IsControlTask()
 {
   for (auto it = outgoing.begin(); it < outgoing.end(); it++)
@@ -157,6 +217,73 @@ bool tPeriodicFrameworkElementTask::IsControlTask()
   return false;
 }
 
+void tPeriodicFrameworkElementTask::AttachTriggerListener()
+{
+  for (core::tEdgeAggregator * aggregator : incoming)
+  {
+    for (auto it = aggregator->ChildPortsBegin(); it != aggregator->ChildPortsEnd(); ++it)
+    {
+      if (data_ports::IsDataFlowType(it->GetDataType()) && it->GetFlag(core::tFrameworkElement::tFlag::ACCEPTS_DATA) &&
+          std::find(trigger_ports.begin(), trigger_ports.end(), &(*it)) == trigger_ports.end())
+      {
+        static_cast<data_ports::common::tAbstractDataPort&>(*it).AddPortListenerRaw(trigger_listener);
+        trigger_ports.push_back(&(*it));
+      }
+    }
+  }
+}
+
+void tPeriodicFrameworkElementTask::DetachTriggerListener()
+{
+  for (core::tAbstractPort * port : trigger_ports)
+  {
+    static_cast<data_ports::common::tAbstractDataPort&>(*port).RemovePortListenerRaw(trigger_listener);
+  }
+  trigger_ports.clear();
+}
+
+void tPeriodicFrameworkElementTask::DetachTriggerListener(core::tAbstractPort& port)
+{
+  auto it = std::find(trigger_ports.begin(), trigger_ports.end(), &port);
+  if (it != trigger_ports.end())
+  {
+    static_cast<data_ports::common::tAbstractDataPort&>(port).RemovePortListenerRaw(trigger_listener);
+    trigger_ports.erase(it);
+  }
+}
+
+bool tPeriodicFrameworkElementTask::MigrateTo(core::tFrameworkElement& thread_container)
+{
+  core::tFrameworkElement* annotated = this->GetAnnotated<core::tFrameworkElement>();
+  tExecutionControl* execution_control = tExecutionControl::Find(thread_container);
+  if ((!annotated) || (!execution_control) || execution_control->GetAnnotated<core::tFrameworkElement>() != &thread_container)
+  {
+    FINROC_LOG_PRINT(WARNING, "Cannot migrate task '", GetLogDescription(), "' to '", thread_container.GetQualifiedName(), "', as it is no thread container");
+    return false;
+  }
+
+  rrlib::thread::tLock lock(annotated->GetStructureMutex());
+  if (!assigned_thread_container)
+  {
+    rrlib::thread::tLock lock2(GetMigratedTasksMutex());
+    GetMigratedTasks().push_back(this);
+  }
+  tRuntimeChangeDispatcher::GetInstance().NotifyTaskMigration(*annotated, assigned_thread_container, &thread_container);
+  assigned_thread_container = &thread_container;
+  return true;
+}
+
+void tPeriodicFrameworkElementTask::SetEventTriggered(bool event_triggered)
+{
+  this->event_triggered = event_triggered;
+  core::tFrameworkElement* annotated = this->GetAnnotated<core::tFrameworkElement>();
+  if ((!event_triggered) && annotated)
+  {
+    rrlib::thread::tLock lock(annotated->GetStructureMutex());
+    DetachTriggerListener();
+  }
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
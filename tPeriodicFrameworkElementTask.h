@@ -42,8 +42,10 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include "rrlib/thread/tTask.h"
+#include "rrlib/thread/tLock.h"
 #include "core/port/tEdgeAggregator.h"
 #include "plugins/data_ports/tOutputPort.h"
+#include "plugins/data_ports/common/tPortListenerRaw.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -99,27 +101,112 @@ public:
   tPeriodicFrameworkElementTask(const std::vector<core::tEdgeAggregator*>& incoming_ports, const std::vector<core::tEdgeAggregator*>& outgoing_ports,
                                 rrlib::thread::tTask& task, tDurationPort execution_duration = tDurationPort());
 
+  ~tPeriodicFrameworkElementTask();
+
+  /*!
+   * \return Thread container that task was migrated to (see MigrateTo()) - NULL if task was not migrated
+   *         (or if the thread container it was migrated to has been deleted meanwhile - see HandBackMigratedTasks())
+   */
+  core::tFrameworkElement* GetAssignedThreadContainer() const
+  {
+    return assigned_thread_container;
+  }
+
   /*!
    * \return Log description - e.g. for debug output
    */
   std::string GetLogDescription();
 
+  /*!
+   * Hands all tasks that were migrated to the specified thread container back to their original thread containers
+   * (called when thread container is deleted - after its thread has been stopped - so that no task refers to it any more).
+   *
+   * \param thread_container Thread container that is deleted
+   */
+  static void HandBackMigratedTasks(core::tFrameworkElement& thread_container);
+
   /*!
    * \return Is this a control task?
    */
   bool IsControlTask();
 
+  /*!
+   * \return Is this an event-triggered task? (see SetEventTriggered())
+   */
+  bool IsEventTriggered() const
+  {
+    return event_triggered;
+  }
+
   /*!
    * \return Is this a sensor task?
    */
   bool IsSenseTask();
 
+  /*!
+   * Migrates task to another thread container during operation (without restructuring or stopping anything).
+   * The thread container currently executing the task drops it from its schedule after its current cycle.
+   * The destination adds it at the correct position in its schedule - and executes it only after it has been
+   * released by the previous container and the period of its last execution there has ended.
+   * Therefore, the task is never executed twice in the same period - nor concurrently with itself.
+   * Handover takes place when the previous thread container starts its next cycle (or its thread is deleted) -
+   * so the task is not executed while the previous thread container is paused.
+   *
+   * \param thread_container Thread container (element with tExecutionControl annotation) to execute task from now on
+   *                         (may also be the task's original thread container)
+   * \return Whether migration was initiated (false if specified element is no thread container)
+   */
+  bool MigrateTo(core::tFrameworkElement& thread_container);
+
+  /*!
+   * Marks this task as event-triggered.
+   * Event-triggered tasks are scheduled like periodic tasks - however, the thread container
+   * only executes them (at their position in the schedule) in cycles after Trigger() has been called.
+   * This way, modules that would otherwise execute in port-change callbacks (in whatever thread publishes)
+   * are executed by the thread container - in the correct order and visible to profiling.
+   *
+   * Should be set before task's framework element is initialized.
+   * When event triggering is turned off, the trigger listener is removed from all ports again.
+   *
+   * \param event_triggered Whether task is event-triggered
+   */
+  void SetEventTriggered(bool event_triggered);
+
+  /*!
+   * Triggers execution of an event-triggered task.
+   * Thread containers call this automatically when new data arrives at the data ports in the task's incoming edge aggregators.
+   * The task is executed once by its thread container - in the current cycle, if its
+   * position in the schedule has not been reached yet - otherwise in the next cycle.
+   * Can be called from any thread. Calling it multiple times before execution has no further effect.
+   */
+  void Trigger()
+  {
+    triggered.store(true, std::memory_order_release);
+  }
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
 private:
 
   friend class tThreadContainerThread;
+  friend class tRuntimeChangeDispatcher;
+  friend struct tScheduleGraph;
+
+  /*! Port listener that triggers event-triggered task on data arrival */
+  class tTriggerListener : public data_ports::common::tPortListenerRaw
+  {
+  public:
+    tTriggerListener(tPeriodicFrameworkElementTask& task) : task(task) {}
+
+    virtual void PortChangedRaw(data_ports::tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) override
+    {
+      task.Trigger();
+    }
+
+  private:
+    tPeriodicFrameworkElementTask& task;
+  };
 
   /*! Task to execute */
   rrlib::thread::tTask& task;
@@ -130,26 +217,111 @@ private:
   /*! Element containing outgoing ports (relevant for execution order) */
   std::vector<core::tEdgeAggregator*> outgoing;
 
-  /*! Tasks to execute before this one (updated during scheduling) */
-  std::vector<tPeriodicFrameworkElementTask*> previous_tasks;
-
-  /*! Tasks to execute after this one (updated during scheduling) */
-  std::vector<tPeriodicFrameworkElementTask*> next_tasks;
-
-  /*! Classification of task (used and updated only during scheduling - also meaning is defined there) */
-  int task_classification;
+  /*!
+   * Thread container that task was migrated to (see MigrateTo()) - NULL if task was not migrated.
+   * Protected by runtime's structure mutex.
+   */
+  core::tFrameworkElement* assigned_thread_container;
 
-  /*! Total execution duration of task */
-  rrlib::time::tDuration total_execution_duration;
+  /*! Thread container that currently executes task (NULL if released - see Claim()) */
+  std::atomic<core::tFrameworkElement*> owner;
 
-  /*! Maximum execution duration of task */
-  rrlib::time::tDuration max_execution_duration;
+  /*! Start of period after the last execution by previous owner (task must not be executed by a new owner earlier) */
+  std::atomic<rrlib::time::tTimestamp> release_time;
 
-  /*! Number of times that task was executed */
-  int64_t execution_count;
+  /*! Index of task in thread container's schedule graph (used and updated only during scheduling - see tScheduleGraph) */
+  size_t schedule_graph_index;
 
   /*! Port to publish last execution duration of task (optional) */
   tDurationPort execution_duration;
+
+  /*! Is this an event-triggered task? (see SetEventTriggered()) */
+  bool event_triggered;
+
+  /*! Has event-triggered task been triggered since its last execution? */
+  std::atomic<bool> triggered;
+
+  /*! Listener attached to incoming data ports of event-triggered task */
+  tTriggerListener trigger_listener;
+
+  /*!
+   * Ports that trigger_listener has been attached to (protected by runtime's structure mutex).
+   * Ports are removed when they are deleted (see tRuntimeChangeDispatcher) - so this list contains no dangling pointers.
+   */
+  std::vector<core::tAbstractPort*> trigger_ports;
+
+  /*!
+   * Attaches trigger listener to all data ports in incoming edge aggregators that accept data
+   * (called by thread container during rescheduling - with runtime's structure mutex locked).
+   * Ports that were added since the last call are attached as well.
+   */
+  void AttachTriggerListener();
+
+  /*!
+   * Removes trigger listener from all ports it has been attached to (runtime's structure mutex must be locked)
+   */
+  void DetachTriggerListener();
+
+  /*!
+   * Removes trigger listener from specified port - if it has been attached to it
+   * (called when port is deleted - with runtime's structure mutex locked)
+   *
+   * \param port Port to remove trigger listener from
+   */
+  void DetachTriggerListener(core::tAbstractPort& port);
+
+  /*!
+   * Called by thread container before executing task that it does not own yet
+   * (usually, because task was migrated to thread container)
+   *
+   * \param thread_container Thread container that wants to execute task
+   * \param cycle_start Start of thread container's current cycle
+   * \return Whether thread container owns task now (false if previous owner has not released it yet - or its period has not ended)
+   */
+  bool Claim(core::tFrameworkElement& thread_container, const rrlib::time::tTimestamp& cycle_start)
+  {
+    core::tFrameworkElement* current_owner = owner.load(std::memory_order_acquire);
+    if (current_owner == &thread_container)
+    {
+      return true;
+    }
+    if (current_owner || cycle_start < release_time.load(std::memory_order_relaxed))
+    {
+      return false;
+    }
+    return owner.compare_exchange_strong(current_owner, &thread_container, std::memory_order_acq_rel);
+  }
+
+  /*!
+   * \return Tasks that were migrated at some point (see MigrateTo()). Mutex must be locked.
+   */
+  static std::vector<tPeriodicFrameworkElementTask*>& GetMigratedTasks();
+
+  /*!
+   * \return Mutex for list of migrated tasks (to be locked after runtime's structure mutex)
+   */
+  static rrlib::thread::tMutex& GetMigratedTasksMutex();
+
+  /*!
+   * Called by owner when it no longer executes task (after migration)
+   *
+   * \param release_time Start of period after the last execution by owner
+   */
+  void Release(const rrlib::time::tTimestamp& release_time)
+  {
+    this->release_time.store(release_time, std::memory_order_relaxed);
+    owner.store(nullptr, std::memory_order_release);
+  }
+
+  /*!
+   * Called by thread container before executing task
+   *
+   * \return Whether task should be executed in current cycle (always true for periodic tasks)
+   */
+  bool ConsumeTrigger()
+  {
+    return (!event_triggered) || triggered.exchange(false, std::memory_order_acquire);
+  }
 };
 
 //----------------------------------------------------------------------
@@ -0,0 +1,142 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tProfilePublisherThread.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tProfilePublisherThread.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tProfilePublisherThread::tProfilePublisherThread(const std::string& container_thread_name, rrlib::time::tDuration cycle_time,
+    data_ports::tOutputPort<rrlib::time::tDuration> execution_duration, data_ports::tOutputPort<std::vector<tTaskProfile>> execution_details,
+    data_ports::tOutputPort<rrlib::serialization::tMemoryBuffer> execution_details_compact) :
+  tLoopThread(cycle_time, false, false),
+  records(),
+  write_index(0),
+  read_index(0),
+  dropped_record_count(0),
+  execution_duration(execution_duration),
+  execution_details(execution_details),
+  spin_duration(),
+  utilization(),
+  execution_details_compact(execution_details_compact),
+  profile_encoder()
+{
+  this->SetName("Profile Publisher for " + container_thread_name);
+}
+
+void tProfilePublisherThread::MainLoopCallback()
+{
+  size_t read_index = this->read_index.load(std::memory_order_relaxed);
+  while (read_index != write_index.load(std::memory_order_acquire))
+  {
+    Publish(records[read_index % cRECORD_BUFFER_SIZE]);
+    read_index++;
+    this->read_index.store(read_index, std::memory_order_release);
+  }
+}
+
+void tProfilePublisherThread::Publish(const tCycleRecord& record)
+{
+  if (record.profiles.empty())
+  {
+    return;
+  }
+  if (record.task_duration_ports)
+  {
+    tTaskDurationPorts& task_duration_ports = *record.task_duration_ports;
+    for (size_t i = 0u; i < task_duration_ports.size() && i + 1 < record.profiles.size(); i++)
+    {
+      if (task_duration_ports[i].GetWrapped())
+      {
+        task_duration_ports[i].Publish(record.profiles[i + 1].last_execution_duration);  // +1, because first task is at index 1
+      }
+    }
+  }
+  execution_duration.Publish(record.profiles[0].last_execution_duration);
+  if (spin_duration.GetWrapped())
+  {
+    spin_duration.Publish(record.spin_duration);
+  }
+  if (utilization.GetWrapped())
+  {
+    utilization.Publish(record.utilization);
+  }
+  data_ports::tPortDataPointer<std::vector<tTaskProfile>> details = execution_details.GetUnusedBuffer();
+  *details = record.profiles;
+  execution_details.Publish(details);
+
+  if (execution_details_compact.GetWrapped())
+  {
+    data_ports::tPortDataPointer<rrlib::serialization::tMemoryBuffer> buffer = execution_details_compact.GetUnusedBuffer();
+    rrlib::serialization::tOutputStream stream(*buffer);
+    profile_encoder.Encode(stream, record.profiles, record.schedule_version);
+    stream.Close();
+    execution_details_compact.Publish(buffer);
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
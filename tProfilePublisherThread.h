@@ -0,0 +1,245 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tProfilePublisherThread.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tProfilePublisherThread
+ *
+ * \b tProfilePublisherThread
+ *
+ * Low-priority thread that publishes the profiling information
+ * recorded by a thread container thread.
+ * This way, the real-time thread merely writes plain values to
+ * preallocated cycle records - and does not need to perform any
+ * port publishing operations (with buffer management and subscriber
+ * notification) inside its cycle.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tProfilePublisherThread_h__
+#define __plugins__scheduling__tProfilePublisherThread_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLoopThread.h"
+#include "plugins/data_ports/tOutputPort.h"
+#include <array>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tPeriodicFrameworkElementTask.h"
+#include "plugins/scheduling/tTaskProfile.h"
+#include "plugins/scheduling/tTaskProfileEncoding.h"
+#include "plugins/scheduling/tUtilization.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Profile publisher thread
+/*!
+ * Low-priority thread that publishes the profiling information
+ * recorded by a thread container thread.
+ * This way, the real-time thread merely writes plain values to
+ * preallocated cycle records - and does not need to perform any
+ * port publishing operations (with buffer management and subscriber
+ * notification) inside its cycle.
+ *
+ * Cycle records are passed from container thread to publisher thread via
+ * a lock-free single-producer/single-consumer ring buffer.
+ */
+class tProfilePublisherThread : public rrlib::thread::tLoopThread
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Ports to publish execution durations of tasks (index is task's index in execution plan) */
+  typedef std::vector<tPeriodicFrameworkElementTask::tDurationPort> tTaskDurationPorts;
+
+  /*! Profiling information on one cycle of thread container */
+  struct tCycleRecord
+  {
+    /*!
+     * The first element contains the profile of the whole thread container.
+     * The other elements contain the profiles of the executed tasks - in the order of their execution
+     */
+    std::vector<tTaskProfile> profiles;
+
+    /*! Ports to publish execution durations of tasks (elements for tasks without port are empty) */
+    std::shared_ptr<tTaskDurationPorts> task_duration_ports;
+
+    /*! Version of schedule that was executed (incremented whenever rescheduling) */
+    uint32_t schedule_version;
+
+    /*! Time container thread spent busy-waiting before cycle (precise wait mode only) */
+    rrlib::time::tDuration spin_duration;
+
+    /*! Utilization of container after cycle (utilization monitoring only) */
+    tUtilization utilization;
+  };
+
+  /*! Number of cycle records in ring buffer */
+  enum { cRECORD_BUFFER_SIZE = 16 };
+
+  /*!
+   * \param container_thread_name Name of container thread (used to create name for this thread)
+   * \param cycle_time Cycle time of publisher thread (typically the container's cycle time)
+   * \param execution_duration Port to publish time spent in container's last cycle
+   * \param execution_details Port to publish details on execution
+   * \param execution_details_compact Port to publish details on execution in compact encoding (see tTaskProfileEncoder)
+   */
+  tProfilePublisherThread(const std::string& container_thread_name, rrlib::time::tDuration cycle_time,
+                          data_ports::tOutputPort<rrlib::time::tDuration> execution_duration,
+                          data_ports::tOutputPort<std::vector<tTaskProfile>> execution_details,
+                          data_ports::tOutputPort<rrlib::serialization::tMemoryBuffer> execution_details_compact);
+
+  /*!
+   * Enqueues record obtained via GetFreeRecord() for publishing.
+   * May only be called by container thread.
+   */
+  void Enqueue()
+  {
+    size_t write_index = this->write_index.load(std::memory_order_relaxed);
+    this->write_index.store(write_index + 1, std::memory_order_release);
+  }
+
+  /*!
+   * \return Number of records that were dropped, because ring buffer was full
+   */
+  int64_t GetDroppedRecordCount() const
+  {
+    return dropped_record_count.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * Obtains free record to fill from ring buffer.
+   * May only be called by container thread.
+   *
+   * \return Free record - or nullptr if ring buffer is full (record of this cycle is dropped in this case)
+   */
+  tCycleRecord* GetFreeRecord()
+  {
+    size_t write_index = this->write_index.load(std::memory_order_relaxed);
+    if (write_index - read_index.load(std::memory_order_acquire) >= cRECORD_BUFFER_SIZE)
+    {
+      dropped_record_count.store(dropped_record_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    return &records[write_index % cRECORD_BUFFER_SIZE];
+  }
+
+  virtual void MainLoopCallback() override;
+
+  /*!
+   * Publishes record immediately in the calling thread
+   * (e.g. used when cycles are executed manually - without any thread running)
+   *
+   * \param record Record to publish
+   */
+  void Publish(const tCycleRecord& record);
+
+  /*!
+   * Sets port to publish time container thread spent busy-waiting in each cycle (precise wait mode).
+   * Must be called before thread is started.
+   *
+   * \param spin_duration Port to publish spin duration to
+   */
+  void SetSpinDurationPort(data_ports::tOutputPort<rrlib::time::tDuration> spin_duration)
+  {
+    this->spin_duration = spin_duration;
+  }
+
+  /*!
+   * Sets port to publish utilization of container to (utilization monitoring).
+   * Must be called before thread is started.
+   *
+   * \param utilization Port to publish utilization to
+   */
+  void SetUtilizationPort(data_ports::tOutputPort<tUtilization> utilization)
+  {
+    this->utilization = utilization;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Ring buffer with cycle records */
+  std::array<tCycleRecord, cRECORD_BUFFER_SIZE> records;
+
+  /*! Number of records that were enqueued (written by container thread only) */
+  std::atomic<size_t> write_index;
+
+  /*! Number of records that were published (written by publisher thread only) */
+  std::atomic<size_t> read_index;
+
+  /*! Number of records that were dropped, because ring buffer was full */
+  std::atomic<int64_t> dropped_record_count;
+
+  /*! Port to publish time spent in container's last cycle */
+  data_ports::tOutputPort<rrlib::time::tDuration> execution_duration;
+
+  /*! Port to publish details on execution */
+  data_ports::tOutputPort<std::vector<tTaskProfile>> execution_details;
+
+  /*! Port to publish time container thread spent busy-waiting in each cycle (only set in precise wait mode) */
+  data_ports::tOutputPort<rrlib::time::tDuration> spin_duration;
+
+  /*! Port to publish utilization of container (only set if utilization monitoring is enabled) */
+  data_ports::tOutputPort<tUtilization> utilization;
+
+  /*! Port to publish details on execution in compact encoding */
+  data_ports::tOutputPort<rrlib::serialization::tMemoryBuffer> execution_details_compact;
+
+  /*! Encoder for compact port */
+  tTaskProfileEncoder profile_encoder;
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
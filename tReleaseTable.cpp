@@ -0,0 +1,97 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tReleaseTable.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tReleaseTable.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+const rrlib::time::tDuration tReleaseTable::cTOLERANCE = std::chrono::microseconds(20);
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tReleaseTable::tReleaseTable() :
+  offsets(),
+  total_budget(0),
+  release_base(rrlib::time::cNO_TIME)
+{}
+
+void tReleaseTable::Compute(const std::vector<rrlib::time::tDuration>& max_execution_durations, size_t task_count, double budget_margin)
+{
+  task_count = std::min(task_count, max_execution_durations.size());
+  offsets.resize(task_count);
+  rrlib::time::tDuration offset = rrlib::time::tDuration::zero();
+  for (size_t i = 0; i < task_count; i++)
+  {
+    offsets[i] = offset;
+    rrlib::time::tDuration max_execution_duration = max_execution_durations[i];
+    offset += max_execution_duration + rrlib::time::tDuration(static_cast<rrlib::time::tDuration::rep>(max_execution_duration.count() * std::max(0.0, budget_margin)));
+  }
+  total_budget = offset;
+}
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
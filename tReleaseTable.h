@@ -0,0 +1,215 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tReleaseTable.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tReleaseTable
+ *
+ * \b tReleaseTable
+ *
+ * Release table of a thread container in time-triggered mode.
+ * Contains the offset - relative to the start of the first task in a cycle - at which
+ * each task is released. Offsets are computed from measured maximum execution durations
+ * plus a relative margin (budget).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tReleaseTable_h__
+#define __plugins__scheduling__tReleaseTable_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/time/time.h"
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Release table for time-triggered mode
+/*!
+ * Release table of a thread container in time-triggered mode.
+ * Contains the offset - relative to the start of the first task in a cycle - at which
+ * each task is released. Offsets are computed from measured maximum execution durations
+ * plus a relative margin (budget).
+ *
+ * A task counts as released late (violation) only if it starts more than cTOLERANCE after
+ * its release time - so that timer resolution and measurement overhead are not counted.
+ * With offsets relative to the first task's start, wake-up latency of the thread does not cause violations either.
+ *
+ * In each cycle, BeginCycle() is called first. Then, for each task executed, the thread waits until
+ * GetReleaseTime() and calls RecordTaskStart() when the task actually starts.
+ */
+class tReleaseTable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Tasks may start this much later than their release time without counting as violation */
+  static const rrlib::time::tDuration cTOLERANCE;
+
+  tReleaseTable();
+
+  /*!
+   * Prepares table for a new cycle (release times are determined by the first task executed in it)
+   */
+  void BeginCycle()
+  {
+    release_base = rrlib::time::cNO_TIME;
+  }
+
+  /*!
+   * Removes all offsets (e.g. when rescheduling)
+   */
+  void Clear()
+  {
+    offsets.clear();
+    total_budget = rrlib::time::tDuration::zero();
+    release_base = rrlib::time::cNO_TIME;
+  }
+
+  /*!
+   * Computes offsets from measured execution durations (allocates memory if table grows)
+   *
+   * \param max_execution_durations Maximum measured execution duration of each task (in order of execution)
+   * \param task_count Number of tasks (starting with the first) to compute offsets for
+   * \param budget_margin Relative margin added to maximum execution duration of each task to obtain its budget (e.g. 0.25 for 25%)
+   */
+  void Compute(const std::vector<rrlib::time::tDuration>& max_execution_durations, size_t task_count, double budget_margin);
+
+  /*!
+   * \param index Index of task
+   * \return Release offset of task relative to the start of the first task in a cycle
+   */
+  rrlib::time::tDuration GetOffset(size_t index) const
+  {
+    return offsets[index];
+  }
+
+  /*!
+   * \param index Index of task
+   * \return Release time of task in current cycle - cNO_TIME if no task has started in current cycle yet (first task executed is released immediately)
+   */
+  rrlib::time::tTimestamp GetReleaseTime(size_t index) const
+  {
+    return release_base == rrlib::time::cNO_TIME ? rrlib::time::cNO_TIME : release_base + offsets[index];
+  }
+
+  /*!
+   * \return Number of tasks in table
+   */
+  size_t GetSize() const
+  {
+    return offsets.size();
+  }
+
+  /*!
+   * \return Sum of budgets of all tasks in table
+   */
+  rrlib::time::tDuration GetTotalBudget() const
+  {
+    return total_budget;
+  }
+
+  /*!
+   * \return Whether table is empty (not computed yet)
+   */
+  bool IsEmpty() const
+  {
+    return offsets.empty();
+  }
+
+  /*!
+   * \param release_base Time that offsets refer to in the current cycle (actual start of first task executed in cycle minus its offset)
+   * \param index Index of task
+   * \param task_start Actual start of task
+   * \return Whether task started too late (more than cTOLERANCE after its release time)
+   */
+  bool IsViolation(const rrlib::time::tTimestamp& release_base, size_t index, const rrlib::time::tTimestamp& task_start) const
+  {
+    return task_start - (release_base + offsets[index]) > cTOLERANCE;
+  }
+
+  /*!
+   * Records actual start of task in current cycle.
+   * The first task executed in a cycle determines the release times of the following ones.
+   *
+   * \param index Index of task
+   * \param task_start Actual start of task
+   * \return Whether task started too late (release offset violation)
+   */
+  bool RecordTaskStart(size_t index, const rrlib::time::tTimestamp& task_start)
+  {
+    if (release_base == rrlib::time::cNO_TIME)
+    {
+      release_base = task_start - offsets[index];
+      return false;
+    }
+    return IsViolation(release_base, index, task_start);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Release offset of each task */
+  std::vector<rrlib::time::tDuration> offsets;
+
+  /*! Sum of budgets of all tasks in table */
+  rrlib::time::tDuration total_budget;
+
+  /*! Time that offsets refer to in the current cycle (actual start of first task executed in cycle minus its offset) - cNO_TIME if no task has started yet */
+  rrlib::time::tTimestamp release_base;
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
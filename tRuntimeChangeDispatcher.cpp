@@ -0,0 +1,344 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tRuntimeChangeDispatcher.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tRuntimeChangeDispatcher.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tPeriodicFrameworkElementTask.h"
+#include "plugins/scheduling/tThreadContainerThread.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tRuntimeChangeDispatcher::tRuntimeChangeDispatcher() :
+  registration_mutex(),
+  mutex(),
+  runtime(nullptr),
+  threads(),
+  thread_container_table(),
+  path(),
+  affected_containers(),
+  open_batch_count(0),
+  deferred_containers()
+{}
+
+void tRuntimeChangeDispatcher::Add(tThreadContainerThread& thread)
+{
+  rrlib::thread::tLock lock(registration_mutex);
+  bool register_listener = false;
+  {
+    rrlib::thread::tLock lock2(mutex);
+    core::tFrameworkElement& thread_container = thread.GetThreadContainer();
+    if (threads.find(&thread_container) == threads.end())
+    {
+      thread_container_table.clear();  // new thread container changes entries of its elements
+    }
+    threads.emplace(&thread_container, &thread);
+    if (!runtime)
+    {
+      runtime = &thread_container.GetRuntime();
+      register_listener = true;
+    }
+  }
+  if (register_listener)
+  {
+    runtime->AddListener(*this);
+  }
+}
+
+void tRuntimeChangeDispatcher::BeginStructureBatch()
+{
+  rrlib::thread::tLock lock(mutex);
+  open_batch_count++;
+}
+
+void tRuntimeChangeDispatcher::CollectAssignedThreadContainer(core::tFrameworkElement& element, std::vector<core::tFrameworkElement*>& containers)
+{
+  for (core::tFrameworkElement* current = &element; current && threads.find(current) == threads.end(); current = current->GetParent())
+  {
+    tPeriodicFrameworkElementTask* task = current->GetAnnotation<tPeriodicFrameworkElementTask>();
+    if (task)
+    {
+      core::tFrameworkElement* assigned_thread_container = task->GetAssignedThreadContainer();
+      if (assigned_thread_container && std::find(containers.begin(), containers.end(), assigned_thread_container) == containers.end())
+      {
+        containers.push_back(assigned_thread_container);
+      }
+      return;
+    }
+  }
+}
+
+void tRuntimeChangeDispatcher::CollectThreadContainers(core::tFrameworkElement& element, std::vector<core::tFrameworkElement*>& containers)
+{
+  for (core::tFrameworkElement* container = GetThreadContainer(element); container; container = GetThreadContainer(*container))
+  {
+    containers.push_back(container);
+  }
+}
+
+void tRuntimeChangeDispatcher::DetachTriggerListener(core::tAbstractPort& port)
+{
+  for (core::tFrameworkElement* current = port.GetParent(); current && threads.find(current) == threads.end(); current = current->GetParent())
+  {
+    tPeriodicFrameworkElementTask* task = current->GetAnnotation<tPeriodicFrameworkElementTask>();
+    if (task)
+    {
+      task->DetachTriggerListener(port);
+      return;
+    }
+  }
+}
+
+void tRuntimeChangeDispatcher::EndStructureBatch()
+{
+  rrlib::thread::tLock lock(mutex);
+  if (open_batch_count <= 0)
+  {
+    FINROC_LOG_PRINT(ERROR, "Structure batch closed without having been opened. Ignoring.");
+    return;
+  }
+  open_batch_count--;
+  if (open_batch_count == 0)
+  {
+    affected_containers.swap(deferred_containers);
+    deferred_containers.clear();
+    NotifyAffectedContainers();
+  }
+}
+
+tRuntimeChangeDispatcher& tRuntimeChangeDispatcher::GetInstance()
+{
+  static tRuntimeChangeDispatcher instance;
+  return instance;
+}
+
+core::tFrameworkElement* tRuntimeChangeDispatcher::GetThreadContainer(core::tFrameworkElement& element)
+{
+  // Walk up parent chain until an element with known entry (or the root) is reached
+  path.clear();
+  core::tFrameworkElement* current = &element;
+  core::tFrameworkElement* result = nullptr;
+  while (current)
+  {
+    auto entry = thread_container_table.find(current->GetHandle());
+    if (entry != thread_container_table.end())
+    {
+      result = entry->second;
+      break;
+    }
+    path.push_back(current);
+    current = current->GetParent();
+  }
+
+  // Compute entries of elements on path (top-down)
+  for (auto it = path.rbegin(); it != path.rend(); ++it)
+  {
+    core::tFrameworkElement* parent = (*it)->GetParent();
+    if (parent && threads.find(parent) != threads.end())
+    {
+      result = parent;
+    }
+    thread_container_table[(*it)->GetHandle()] = result;
+  }
+  return result;
+}
+
+bool tRuntimeChangeDispatcher::IsStructureBatchActive()
+{
+  rrlib::thread::tLock lock(mutex);
+  return open_batch_count > 0;
+}
+
+void tRuntimeChangeDispatcher::NotifyAffectedContainers(bool urgent)
+{
+  for (core::tFrameworkElement * container : affected_containers)
+  {
+    if (open_batch_count > 0 && (!urgent))
+    {
+      if (std::find(deferred_containers.begin(), deferred_containers.end(), container) == deferred_containers.end())
+      {
+        deferred_containers.push_back(container);
+      }
+      continue;
+    }
+    auto range = threads.equal_range(container);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+      it->second->RequestReschedule();
+    }
+  }
+}
+
+void tRuntimeChangeDispatcher::NotifyTaskMigration(core::tFrameworkElement& element, core::tFrameworkElement* previous_thread_container, core::tFrameworkElement* thread_container)
+{
+  rrlib::thread::tLock lock(mutex);
+  if (threads.empty())
+  {
+    return;
+  }
+  affected_containers.clear();
+  CollectThreadContainers(element, affected_containers);
+  if (previous_thread_container)
+  {
+    affected_containers.push_back(previous_thread_container);
+  }
+  if (thread_container && thread_container != previous_thread_container)
+  {
+    affected_containers.push_back(thread_container);
+  }
+  NotifyAffectedContainers();
+}
+
+void tRuntimeChangeDispatcher::OnEdgeChange(core::tRuntimeListener::tEvent change_type, core::tAbstractPort& source, core::tAbstractPort& target)
+{
+  rrlib::thread::tLock lock(mutex);
+  if (threads.empty())
+  {
+    return;
+  }
+
+  // Thread containers that contain both source and target are affected
+  affected_containers.clear();
+  CollectThreadContainers(source, affected_containers);
+  size_t source_container_count = affected_containers.size();
+  if (source_container_count)
+  {
+    CollectThreadContainers(target, affected_containers);
+    auto target_containers_begin = affected_containers.begin() + source_container_count;
+    auto affected_end = std::remove_if(affected_containers.begin(), target_containers_begin, [&](core::tFrameworkElement * container)
+    {
+      return std::find(target_containers_begin, affected_containers.end(), container) == affected_containers.end();
+    });
+    affected_containers.erase(affected_end, affected_containers.end());
+  }
+
+  // Tasks migrated to other thread containers are scheduled there - so their edge changes affect these containers as well
+  CollectAssignedThreadContainer(source, affected_containers);
+  CollectAssignedThreadContainer(target, affected_containers);
+  NotifyAffectedContainers(change_type == core::tRuntimeListener::tEvent::REMOVE && (source.IsDeleted() || target.IsDeleted()));  // edges of deleted elements
+}
+
+void tRuntimeChangeDispatcher::OnFrameworkElementChange(core::tRuntimeListener::tEvent change_type, core::tFrameworkElement& element)
+{
+  rrlib::thread::tLock lock(mutex);
+  if (threads.empty())
+  {
+    return;
+  }
+
+  if (element.GetAnnotation<tPeriodicFrameworkElementTask>())
+  {
+    affected_containers.clear();
+    CollectThreadContainers(element, affected_containers);
+    CollectAssignedThreadContainer(element, affected_containers);
+    NotifyAffectedContainers(change_type == core::tRuntimeListener::tEvent::REMOVE);  // deleted task must not be executed any more
+  }
+  if (change_type == core::tRuntimeListener::tEvent::REMOVE)
+  {
+    thread_container_table.erase(element.GetHandle());  // handle may be reused
+    if (element.GetFlag(core::tFrameworkElement::tFlag::PORT))
+    {
+      DetachTriggerListener(static_cast<core::tAbstractPort&>(element));
+    }
+  }
+}
+
+void tRuntimeChangeDispatcher::Remove(tThreadContainerThread& thread)
+{
+  rrlib::thread::tLock lock(registration_mutex);
+  core::tRuntimeEnvironment* unregister_runtime = nullptr;
+  {
+    rrlib::thread::tLock lock2(mutex);
+    core::tFrameworkElement* thread_container = &thread.GetThreadContainer();
+    auto range = threads.equal_range(thread_container);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+      if (it->second == &thread)
+      {
+        threads.erase(it);
+        break;
+      }
+    }
+    if (threads.find(thread_container) == threads.end())
+    {
+      thread_container_table.clear();
+      deferred_containers.erase(std::remove(deferred_containers.begin(), deferred_containers.end(), thread_container), deferred_containers.end());
+    }
+    if (threads.empty())
+    {
+      unregister_runtime = runtime;
+      runtime = nullptr;
+    }
+  }
+  if (unregister_runtime)
+  {
+    unregister_runtime->RemoveListener(*this);
+  }
+}
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,228 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tRuntimeChangeDispatcher.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tRuntimeChangeDispatcher
+ *
+ * \b tRuntimeChangeDispatcher
+ *
+ * Single runtime listener for all thread containers.
+ * Maps changed framework elements to the thread containers they belong to
+ * (via a memoized table indexed by element handle) - and only notifies the
+ * affected thread containers.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tRuntimeChangeDispatcher_h__
+#define __plugins__scheduling__tRuntimeChangeDispatcher_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include "rrlib/util/tNoncopyable.h"
+#include "core/tRuntimeEnvironment.h"
+#include "core/tRuntimeListener.h"
+#include <unordered_map>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+class tThreadContainerThread;
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Dispatcher for runtime change events
+/*!
+ * Single runtime listener for all thread containers.
+ * Maps changed framework elements to the thread containers they belong to and only notifies
+ * the affected thread containers - instead of every thread container checking every change
+ * by walking parent chains (which is expensive with many thread containers and bulk connection setup).
+ *
+ * The thread container (nearest ancestor thread container) of each element is memoized in a table
+ * indexed by element handle. Entries are computed from the parent's entry - so each parent chain
+ * is walked only once.
+ *
+ * While structure batches are open (see tStructureBatch), affected thread containers are marked as deferred
+ * instead of being notified - and are notified once when the last batch is closed.
+ * Other thread containers are not affected by open batches.
+ */
+class tRuntimeChangeDispatcher : public core::tRuntimeListener, private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \return Singleton instance
+   */
+  static tRuntimeChangeDispatcher& GetInstance();
+
+  /*!
+   * Registers thread container thread. It is notified of relevant changes from now on.
+   *
+   * \param thread Thread to add
+   */
+  void Add(tThreadContainerThread& thread);
+
+  /*!
+   * Opens structure batch (see tStructureBatch::Begin())
+   */
+  void BeginStructureBatch();
+
+  /*!
+   * Closes structure batch (see tStructureBatch::End()).
+   * When the last batch is closed, deferred thread containers are notified.
+   */
+  void EndStructureBatch();
+
+  /*!
+   * \return Whether any structure batch is currently open
+   */
+  bool IsStructureBatchActive();
+
+  /*!
+   * Notifies thread containers affected by migration of a task (see tPeriodicFrameworkElementTask::MigrateTo()):
+   * the thread containers of the task's element, the one it was assigned to before and the one it is assigned to now. Only these reschedule.
+   * (runtime's structure mutex must be locked)
+   *
+   * \param element Element with task annotation
+   * \param previous_thread_container Thread container that task was migrated to before (NULL if it was not migrated)
+   * \param thread_container Thread container that task is migrated to (NULL if it is handed back to the element's thread container)
+   */
+  void NotifyTaskMigration(core::tFrameworkElement& element, core::tFrameworkElement* previous_thread_container, core::tFrameworkElement* thread_container);
+
+  /*!
+   * Unregisters thread container thread
+   *
+   * \param thread Thread to remove
+   */
+  void Remove(tThreadContainerThread& thread);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Mutex for (un)registration of threads (locked before runtime's listener mutex) */
+  rrlib::thread::tMutex registration_mutex;
+
+  /*! Mutex for tables below */
+  rrlib::thread::tMutex mutex;
+
+  /*! Runtime that dispatcher is registered at as listener (NULL if no threads are registered) */
+  core::tRuntimeEnvironment* runtime;
+
+  /*! Registered threads by thread container */
+  std::unordered_multimap<core::tFrameworkElement*, tThreadContainerThread*> threads;
+
+  /*! Memoized thread container of each element (by handle) - NULL if element is not part of any thread container */
+  std::unordered_map<core::tFrameworkElement::tHandle, core::tFrameworkElement*> thread_container_table;
+
+  /*! Elements whose table entries are being computed (temporary - member to avoid reallocation) */
+  std::vector<core::tFrameworkElement*> path;
+
+  /*! Thread containers affected by current change (temporary - member to avoid reallocation) */
+  std::vector<core::tFrameworkElement*> affected_containers;
+
+  /*! Number of currently open structure batches */
+  int open_batch_count;
+
+  /*! Thread containers affected by changes while structure batches are open (notified when last batch is closed) */
+  std::vector<core::tFrameworkElement*> deferred_containers;
+
+  tRuntimeChangeDispatcher();
+
+  /*!
+   * Adds thread container that task of element was migrated to (see tPeriodicFrameworkElementTask::MigrateTo()) to list - if there is such a task.
+   * The task is looked up at the element and its parents (up to the next thread container), e.g. at a port's interface or module.
+   * (mutex and runtime's structure mutex must be locked)
+   *
+   * \param element Element whose task to look up
+   * \param containers List to add thread container to
+   */
+  void CollectAssignedThreadContainer(core::tFrameworkElement& element, std::vector<core::tFrameworkElement*>& containers);
+
+  /*!
+   * Adds thread container and all enclosing thread containers to list (mutex must be locked)
+   *
+   * \param element Element whose thread containers to add
+   * \param containers List to add thread containers to
+   */
+  void CollectThreadContainers(core::tFrameworkElement& element, std::vector<core::tFrameworkElement*>& containers);
+
+  /*!
+   * Removes trigger listener of event-triggered task from port that is deleted (so that task holds no dangling port pointer).
+   * The task is looked up at the port's parents (up to the next thread container).
+   * (mutex and runtime's structure mutex must be locked)
+   *
+   * \param port Port that is deleted
+   */
+  void DetachTriggerListener(core::tAbstractPort& port);
+
+  /*!
+   * \param element Framework element
+   * \return Nearest ancestor of element that is a thread container - NULL if there is none (mutex must be locked)
+   */
+  core::tFrameworkElement* GetThreadContainer(core::tFrameworkElement& element);
+
+  /*!
+   * Notifies threads of all thread containers in affected_containers (mutex must be locked).
+   * While structure batches are open, these containers are marked as deferred instead - unless notification is urgent.
+   *
+   * \param urgent Notify immediately also if structure batches are open? (e.g. if a task is deleted - so that it is not executed any more)
+   */
+  void NotifyAffectedContainers(bool urgent = false);
+
+  virtual void OnEdgeChange(core::tRuntimeListener::tEvent change_type, core::tAbstractPort& source, core::tAbstractPort& target) override;
+
+  virtual void OnFrameworkElementChange(core::tRuntimeListener::tEvent change_type, core::tFrameworkElement& element) override;
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,201 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tScheduleGraph.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tScheduleGraph
+ *
+ * \b tScheduleGraph
+ *
+ * Scheduling data that a thread container thread builds when rescheduling.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tScheduleGraph_h__
+#define __plugins__scheduling__tScheduleGraph_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tPeriodicFrameworkElementTask.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Schedule graph
+/*!
+ * Data that a thread container thread builds when rescheduling.
+ * Tasks are referred to by their index in 'tasks'. Edges are stored in flat arrays (CSR layout).
+ *
+ * Arrays are cleared - not freed - when rebuilding. So, once capacities are sufficient,
+ * building the schedule graph and ordering tasks does not allocate any memory (like an arena that is released in one step).
+ * This avoids allocator churn and memory fragmentation with very large thread containers.
+ * (Other steps of rescheduling still allocate - e.g. task names for flight recorder and telemetry, and the new execution plan's statistics.)
+ */
+struct tScheduleGraph
+{
+  /*! Tasks of thread container (ordered by handle, so that schedules are deterministic) */
+  std::vector<tPeriodicFrameworkElementTask*> tasks;
+
+  /*! Classification flags of each task (see tTaskClassificationFlag in tThreadContainerThread.cpp) */
+  std::vector<int> classification;
+
+  /*! Bit mask with task sets that each task belongs to (bit i: task set i) */
+  std::vector<uint8_t> task_sets;
+
+  /*! Sense and control interfaces */
+  std::vector<core::tEdgeAggregator*> sense_interfaces, control_interfaces;
+
+  /*! Edges (source, destination) of task set currently scheduled - before they are stored in CSR layout */
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+
+  /*! Successors of task i are successors[successor_offsets[i]] to successors[successor_offsets[i + 1] - 1] */
+  std::vector<uint32_t> successor_offsets, successors;
+
+  /*! Predecessors of task i are predecessors[predecessor_offsets[i]] to predecessors[predecessor_offsets[i + 1] - 1] */
+  std::vector<uint32_t> predecessor_offsets, predecessors;
+
+  /*! Number of each task's predecessors that have not been scheduled yet */
+  std::vector<uint32_t> pending_predecessor_count;
+
+  /*! Has task been scheduled (in current task set)? */
+  std::vector<uint8_t> scheduled;
+
+  /*! Longest remaining path from each task to the end of task set (priority - see tThreadContainerThread::Reschedule()) */
+  std::vector<int64_t> remaining_path;
+
+  /*! Position in schedule of each task's most recently scheduled predecessor (-1 if there is none) */
+  std::vector<int64_t> last_predecessor_position;
+
+  /*! Temporary arrays: tasks of current task set, ready tasks (binary heap), trace back for loop detection, DFS stack and edge cursors */
+  std::vector<uint32_t> set_members, ready_tasks, trace_back, stack, edge_cursor;
+
+  /*! Handle and index of each task in the previous execution plan - sorted by handle (to look up measured durations and carry over statistics) */
+  std::vector<std::pair<core::tFrameworkElement::tHandle, size_t>> previous_plan_index;
+
+  /*! Removes all data (keeps capacities) */
+  void Clear()
+  {
+    tasks.clear();
+    classification.clear();
+    task_sets.clear();
+    sense_interfaces.clear();
+    control_interfaces.clear();
+    edges.clear();
+    previous_plan_index.clear();
+  }
+
+  /*!
+   * Stores 'edges' in CSR layout
+   */
+  void BuildAdjacency()
+  {
+    size_t task_count = tasks.size();
+    successor_offsets.assign(task_count + 1, 0);
+    predecessor_offsets.assign(task_count + 1, 0);
+    for (auto & edge : edges)
+    {
+      successor_offsets[edge.first + 1]++;
+      predecessor_offsets[edge.second + 1]++;
+    }
+    for (size_t i = 0; i < task_count; i++)
+    {
+      successor_offsets[i + 1] += successor_offsets[i];
+      predecessor_offsets[i + 1] += predecessor_offsets[i];
+    }
+    successors.resize(edges.size());
+    predecessors.resize(edges.size());
+    edge_cursor.assign(successor_offsets.begin(), successor_offsets.end() - 1);
+    for (auto & edge : edges)
+    {
+      successors[edge_cursor[edge.first]++] = edge.second;
+    }
+    edge_cursor.assign(predecessor_offsets.begin(), predecessor_offsets.end() - 1);
+    for (auto & edge : edges)
+    {
+      predecessors[edge_cursor[edge.second]++] = edge.first;
+    }
+  }
+
+  /*!
+   * \return Memory allocated for scheduling data (in bytes)
+   */
+  size_t GetMemoryUsage() const
+  {
+    return tasks.capacity() * sizeof(tPeriodicFrameworkElementTask*) + classification.capacity() * sizeof(int) + task_sets.capacity() +
+           (sense_interfaces.capacity() + control_interfaces.capacity()) * sizeof(core::tEdgeAggregator*) + edges.capacity() * sizeof(std::pair<uint32_t, uint32_t>) +
+           (successor_offsets.capacity() + successors.capacity() + predecessor_offsets.capacity() + predecessors.capacity() + pending_predecessor_count.capacity()) * sizeof(uint32_t) +
+           scheduled.capacity() + (remaining_path.capacity() + last_predecessor_position.capacity()) * sizeof(int64_t) +
+           (set_members.capacity() + ready_tasks.capacity() + trace_back.capacity() + stack.capacity() + edge_cursor.capacity()) * sizeof(uint32_t) +
+           previous_plan_index.capacity() * sizeof(std::pair<core::tFrameworkElement::tHandle, size_t>);
+  }
+
+  /*!
+   * \param handle Handle of task
+   * \return Index of task in previous execution plan - or -1 if it was not part of it
+   */
+  int64_t PreviousPlanIndexOf(core::tFrameworkElement::tHandle handle) const
+  {
+    auto it = std::lower_bound(previous_plan_index.begin(), previous_plan_index.end(), std::make_pair(handle, static_cast<size_t>(0)));
+    return (it != previous_plan_index.end() && it->first == handle) ? static_cast<int64_t>(it->second) : -1;
+  }
+
+  /*!
+   * \param task Task
+   * \return Index of task in graph - or -1 if task is not part of graph
+   */
+  int64_t IndexOf(const tPeriodicFrameworkElementTask& task) const
+  {
+    return (task.schedule_graph_index < tasks.size() && tasks[task.schedule_graph_index] == &task) ? static_cast<int64_t>(task.schedule_graph_index) : -1;
+  }
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
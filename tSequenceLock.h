@@ -0,0 +1,167 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tSequenceLock.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tSequenceLock
+ *
+ * \b tSequenceLock
+ *
+ * Sequence lock (seqlock) for data that is written by a single thread
+ * and read by arbitrary other threads (or processes - via shared memory).
+ * The writer never blocks. Readers retry if data was modified while reading.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tSequenceLock_h__
+#define __plugins__scheduling__tSequenceLock_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Sequence lock
+/*!
+ * Sequence lock (seqlock) for data that is written by a single thread
+ * and read by arbitrary other threads (or processes - via shared memory).
+ * The writer never blocks. Readers retry if data was modified while reading.
+ *
+ * As this class has standard layout and no constructor side effects (apart from zero initialization),
+ * it can be placed in shared memory.
+ */
+class tSequenceLock
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tSequenceLock() :
+    sequence(0)
+  {}
+
+  /*!
+   * Begins reading protected data
+   *
+   * \return Sequence number to pass to ValidateRead() after reading
+   */
+  uint32_t BeginRead() const
+  {
+    uint32_t result = sequence.load(std::memory_order_acquire);
+    while (result & 1)
+    {
+      // writer is currently active
+      std::this_thread::yield();
+      result = sequence.load(std::memory_order_acquire);
+    }
+    return result;
+  }
+
+  /*!
+   * Non-blocking variant of BeginRead()
+   * (e.g. for readers in other processes that must not hang if the writer process died while writing)
+   *
+   * \param sequence_at_begin Sequence number to pass to ValidateRead() after reading
+   * \return False if writer is currently active (sequence_at_begin is not set in this case)
+   */
+  bool TryBeginRead(uint32_t& sequence_at_begin) const
+  {
+    uint32_t result = sequence.load(std::memory_order_acquire);
+    if (result & 1)
+    {
+      return false;
+    }
+    sequence_at_begin = result;
+    return true;
+  }
+
+  /*!
+   * Begins writing protected data (may only be called by writer thread)
+   */
+  void BeginWrite()
+  {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  /*!
+   * Completes writing protected data (may only be called by writer thread)
+   */
+  void EndWrite()
+  {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /*!
+   * \param sequence_at_begin Sequence number returned by BeginRead()
+   * \return True if data read since BeginRead() is consistent. False if it needs to be read again.
+   */
+  bool ValidateRead(uint32_t sequence_at_begin) const
+  {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return sequence.load(std::memory_order_relaxed) == sequence_at_begin;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Sequence number - odd while writer is modifying data */
+  std::atomic<uint32_t> sequence;
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,174 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tSingleThreadedExecutor.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tSingleThreadedExecutor.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tThread.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tThreadContainerThread.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+/*! Time to sleep in Run() while there is no container to execute */
+static const rrlib::time::tDuration cIDLE_SLEEP_DURATION = std::chrono::milliseconds(10);
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tSingleThreadedExecutor::tSingleThreadedExecutor() :
+  entries(),
+  current_container(nullptr),
+  stop_signal(false)
+{}
+
+void tSingleThreadedExecutor::Add(tThreadContainerThread& container)
+{
+  entries.push_back(tEntry { &container, rrlib::time::cNO_TIME });
+}
+
+bool tSingleThreadedExecutor::ExecuteNext()
+{
+  rrlib::time::tTimestamp now = rrlib::time::Now(true);
+  tEntry* next = nullptr;
+  for (auto it = entries.begin(); it != entries.end(); ++it)
+  {
+    if (it->container->IsPauseRequested() || it->container->IsStopSignalSet())
+    {
+      it->next_release = rrlib::time::cNO_TIME;
+      continue;
+    }
+    if (it->next_release == rrlib::time::cNO_TIME)
+    {
+      it->next_release = now;  // (re)started: release immediately
+    }
+    if ((!next) || it->next_release < next->next_release)
+    {
+      next = &(*it);
+    }
+  }
+  if (!next)
+  {
+    return false;
+  }
+
+  if (next->next_release > now)
+  {
+    rrlib::thread::tThread::Sleep(next->next_release - now, true);
+  }
+  tThreadContainerThread* container = next->container;
+  rrlib::time::tTimestamp release = next->next_release;
+  current_container = container;
+  container->MainLoopCallback();
+  current_container = nullptr;
+
+  // container may have been removed during its cycle
+  for (auto it = entries.begin(); it != entries.end(); ++it)
+  {
+    if (it->container == container)
+    {
+      if (it->next_release != rrlib::time::cNO_TIME)
+      {
+        it->next_release = release + container->GetCycleTime();
+        now = rrlib::time::Now(true);
+        if (it->next_release + container->GetCycleTime() < now)
+        {
+          it->next_release = now;  // skip missed cycles
+        }
+      }
+      break;
+    }
+  }
+  return true;
+}
+
+tSingleThreadedExecutor& tSingleThreadedExecutor::GetInstance()
+{
+  static tSingleThreadedExecutor instance;
+  return instance;
+}
+
+void tSingleThreadedExecutor::Remove(tThreadContainerThread& container)
+{
+  for (auto it = entries.begin(); it != entries.end(); ++it)
+  {
+    if (it->container == &container)
+    {
+      entries.erase(it);
+      return;
+    }
+  }
+}
+
+void tSingleThreadedExecutor::Run()
+{
+  stop_signal = false;
+  while (!stop_signal)
+  {
+    if (!ExecuteNext())
+    {
+      rrlib::thread::tThread::Sleep(cIDLE_SLEEP_DURATION, true);
+    }
+  }
+}
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,173 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tSingleThreadedExecutor.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tSingleThreadedExecutor
+ *
+ * \b tSingleThreadedExecutor
+ *
+ * Cooperative executor for builds without threads (RRLIB_SINGLE_THREADED).
+ * Multiplexes any number of thread containers on the calling thread -
+ * according to their cycle times (earliest deadline first).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tSingleThreadedExecutor_h__
+#define __plugins__scheduling__tSingleThreadedExecutor_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/time/time.h"
+#include "rrlib/util/tNoncopyable.h"
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+class tThreadContainerThread;
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Executes multiple thread containers on a single thread
+/*!
+ * Executes the cycles of any number of thread containers on a single thread.
+ * Each container is released once per cycle time. Among released containers,
+ * the one with the earliest deadline (= next release) is executed first.
+ * If a container's cycle is delayed by more than a complete cycle, missed cycles are skipped
+ * (as tLoopThread does).
+ *
+ * In single-threaded builds (RRLIB_SINGLE_THREADED), every thread container
+ * registers with the singleton instance - and the application's main loop calls Run()
+ * (or ExecuteNext() repeatedly).
+ *
+ * This class is not thread-safe - it is meant to be used by a single thread only.
+ */
+class tSingleThreadedExecutor : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tSingleThreadedExecutor();
+
+  /*!
+   * Adds thread container to executor
+   * (executed whenever its execution is not paused or stopped)
+   *
+   * \param container Thread container to add
+   */
+  void Add(tThreadContainerThread& container);
+
+  /*!
+   * Executes the next cycle of the container with the earliest deadline.
+   * Sleeps until this cycle is due.
+   *
+   * \return False if there is no container to execute (nothing was executed in this case)
+   */
+  bool ExecuteNext();
+
+  /*!
+   * \return Thread container whose cycle is currently executed (NULL if there is none)
+   */
+  tThreadContainerThread* GetCurrentContainer() const
+  {
+    return current_container;
+  }
+
+  /*!
+   * \return Executor that thread containers register with in single-threaded builds
+   */
+  static tSingleThreadedExecutor& GetInstance();
+
+  /*!
+   * Removes thread container from executor
+   *
+   * \param container Thread container to remove
+   */
+  void Remove(tThreadContainerThread& container);
+
+  /*!
+   * Executes thread containers until StopExecution() is called
+   */
+  void Run();
+
+  /*!
+   * Makes Run() return after the current cycle
+   */
+  void StopExecution()
+  {
+    stop_signal = true;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Container with its next release time */
+  struct tEntry
+  {
+    tThreadContainerThread* container;
+
+    /*! Time when next cycle of container is due (cNO_TIME while container is paused or stopped) */
+    rrlib::time::tTimestamp next_release;
+  };
+
+  /*! Thread containers executed by this executor */
+  std::vector<tEntry> entries;
+
+  /*! Thread container whose cycle is currently executed */
+  tThreadContainerThread* current_container;
+
+  /*! Set to make Run() return */
+  bool stop_signal;
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
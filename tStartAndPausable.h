@@ -40,6 +40,7 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include "rrlib/util/tNoncopyable.h"
+#include "rrlib/time/time.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -72,6 +73,14 @@ class tStartAndPausable : private rrlib::util::tNoncopyable
 //----------------------------------------------------------------------
 public:
 
+  /*!
+   * \return Offset of first cycle relative to common start time when started synchronized with other elements (see tExecutionControl::StartAll)
+   */
+  virtual rrlib::time::tDuration GetPhaseOffset()
+  {
+    return rrlib::time::tDuration::zero();
+  }
+
   /*!
    * \return Whether element currently executing
    */
@@ -82,11 +91,48 @@ public:
    */
   virtual void PauseExecution() = 0;
 
+  /*!
+   * Prepares starting execution, so that a subsequent StartExecution() call returns as quickly as possible
+   * (e.g. by creating threads in advance). Used for synchronized starting of multiple elements.
+   */
+  virtual void PrepareExecution()
+  {
+  }
+
+  /*!
+   * Requests that execution is paused - without blocking.
+   * Together with WaitUntilPaused(), this allows pausing multiple elements in parallel.
+   * (default implementation simply calls PauseExecution())
+   */
+  virtual void RequestPause()
+  {
+    PauseExecution();
+  }
+
   /*!
    * Starts execution
    */
   virtual void StartExecution() = 0;
 
+  /*!
+   * Starts execution - with the first cycle beginning at the specified time
+   * (returns immediately - used for synchronized starting of multiple elements).
+   * Default implementation ignores the start time and simply calls StartExecution().
+   *
+   * \param start_time Time at which first cycle is to begin
+   */
+  virtual void StartExecutionAt(const rrlib::time::tTimestamp& start_time)
+  {
+    StartExecution();
+  }
+
+  /*!
+   * Blocks until execution has paused after RequestPause() was called
+   */
+  virtual void WaitUntilPaused()
+  {
+  }
+
 };
 
 //----------------------------------------------------------------------
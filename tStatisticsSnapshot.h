@@ -0,0 +1,106 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tStatisticsSnapshot.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tStatisticsSnapshot
+ *
+ * \b tStatisticsSnapshot
+ *
+ * Consistent copy of the execution statistics of a thread container and
+ * its tasks (see tThreadContainerThread::GetStatisticsSnapshot()).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tStatisticsSnapshot_h__
+#define __plugins__scheduling__tStatisticsSnapshot_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tTaskProfile.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Statistics snapshot
+/*!
+ * Consistent copy of the execution statistics of a thread container and its tasks
+ * (see tThreadContainerThread::GetStatisticsSnapshot()).
+ * Can be obtained from any thread - without going through ports and without blocking the thread container.
+ */
+struct tStatisticsSnapshot
+{
+  /*! Number of cycles executed (including the first/initial execution that is not included in statistics) */
+  uint64_t cycle_count;
+
+  /*! Version of schedule that statistics refer to (incremented whenever thread container reschedules) */
+  uint32_t schedule_version;
+
+  /*!
+   * Profiles with statistics.
+   * The first element contains the profile of the whole thread container.
+   * The other elements contain the profiles of the scheduled tasks - in the order of their execution
+   * (as published via thread container's execution details port)
+   */
+  std::vector<tTaskProfile> profiles;
+
+  /*! Number of executions of thread container (first element) and tasks (other elements) included in statistics - index as in profiles */
+  std::vector<uint64_t> execution_counts;
+
+  tStatisticsSnapshot() :
+    cycle_count(0),
+    schedule_version(0),
+    profiles(),
+    execution_counts()
+  {}
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
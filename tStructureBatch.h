@@ -0,0 +1,130 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tStructureBatch.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tStructureBatch
+ *
+ * \b tStructureBatch
+ *
+ * Scope for bulk structure changes (e.g. loading an application or applying
+ * a connection set). While any structure batch is open, thread containers
+ * do not reschedule - each affected container rebuilds its schedule once
+ * after the last batch has been closed.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tStructureBatch_h__
+#define __plugins__scheduling__tStructureBatch_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Structure batch scope
+/*!
+ * Scope for bulk structure changes (e.g. loading an application or applying a connection set).
+ * Without it, running thread containers rebuild their schedules over and over in consecutive cycles
+ * while changes are applied - also contending for the structure mutex.
+ *
+ * While any structure batch is open, thread containers affected by changes are marked as deferred and do not reschedule
+ * (see tRuntimeChangeDispatcher). Each of them rebuilds its schedule once - in its first cycle after the last batch has been closed.
+ * Other thread containers are not affected. Deleting a task still causes its thread container to reschedule immediately
+ * (so that the task is not executed any more).
+ *
+ * Batches may be nested and opened from multiple threads.
+ * They can be used as RAII scope (object of this class) - or via Begin() and End()
+ * if opening and closing happens in different calls (e.g. in network handlers).
+ */
+class tStructureBatch : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * Opens structure batch
+   */
+  tStructureBatch()
+  {
+    Begin();
+  }
+
+  /*!
+   * Closes structure batch
+   */
+  ~tStructureBatch()
+  {
+    End();
+  }
+
+  /*!
+   * Opens structure batch (must be closed with End())
+   */
+  static void Begin();
+
+  /*!
+   * Closes structure batch opened with Begin()
+   * (an error is logged - and the call is ignored - if there is no open batch)
+   */
+  static void End();
+
+  /*!
+   * \return Whether any structure batch is currently open (affected thread containers defer rescheduling in this case)
+   */
+  static bool IsActive();
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -89,6 +89,40 @@ struct tTaskProfile
   /*! Total execution duration */
   rrlib::time::tDuration total_execution_duration;
 
+  /*!
+   * CPU time consumed by last execution
+   * (only measured if resource usage profiling is enabled - see SetResourceUsageProfilingEnabled())
+   */
+  rrlib::time::tDuration last_cpu_time;
+
+  /*! Voluntary context switches during last execution (e.g. blocking on a mutex or I/O - only measured if resource usage profiling is enabled) */
+  uint32_t last_voluntary_context_switches;
+
+  /*! Involuntary context switches during last execution (preemption - only measured if resource usage profiling is enabled) */
+  uint32_t last_involuntary_context_switches;
+
+  /*! Minor page faults during last execution (only measured if resource usage profiling is enabled) */
+  uint32_t last_minor_page_faults;
+
+  /*! Major page faults during last execution (only measured if resource usage profiling is enabled) */
+  uint32_t last_major_page_faults;
+
+  /*!
+   * CPU cycles during last execution
+   * (only measured if performance counter profiling is enabled - see SetPerformanceCounterProfilingEnabled().
+   *  If no hardware counters are available, this is the CPU time in nanoseconds)
+   */
+  uint64_t last_cycles;
+
+  /*! Instructions executed during last execution (only measured if performance counter profiling is enabled) */
+  uint64_t last_instructions;
+
+  /*! Cache misses during last execution (only measured if performance counter profiling is enabled) */
+  uint64_t last_cache_misses;
+
+  /*! Branch misses during last execution (only measured if performance counter profiling is enabled) */
+  uint64_t last_branch_misses;
+
   /*! Handle of framework element associated with task */
   core::tFrameworkElement::tHandle handle;
 
@@ -100,12 +134,31 @@ struct tTaskProfile
     max_execution_duration(0),
     average_execution_duration(0),
     total_execution_duration(0),
+    last_cpu_time(0),
+    last_voluntary_context_switches(0),
+    last_involuntary_context_switches(0),
+    last_minor_page_faults(0),
+    last_major_page_faults(0),
+    last_cycles(0),
+    last_instructions(0),
+    last_cache_misses(0),
+    last_branch_misses(0),
     handle(0),
     task_classification(tTaskClassification::OTHER)
   {}
 
+  /*!
+   * \return Instructions per cycle in last execution (zero if not measured)
+   */
+  double GetInstructionsPerCycle() const
+  {
+    return last_cycles ? static_cast<double>(last_instructions) / static_cast<double>(last_cycles) : 0.0;
+  }
 };
 
+// Serialization keeps the original format (so that existing tools and recorded data can still be read).
+// Resource usage and performance counter values are not serialized - remote receivers obtain them via
+// the compact encoding (see tTaskProfileEncoding), which contains all fields.
 inline rrlib::serialization::tOutputStream &operator << (rrlib::serialization::tOutputStream &stream, const tTaskProfile &profile)
 {
   stream << profile.last_execution_duration << profile.max_execution_duration << profile.average_execution_duration
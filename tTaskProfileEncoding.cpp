@@ -0,0 +1,336 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tTaskProfileEncoding.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tTaskProfileEncoding.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Frame types */
+enum tFrameType
+{
+  eKEY_FRAME,
+  eDELTA_FRAME
+};
+
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Number of encoded fields per profile */
+const size_t cFIELD_COUNT = 13;
+
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+static void WriteVarint(rrlib::serialization::tOutputStream& stream, uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    stream.WriteByte(static_cast<int8_t>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  stream.WriteByte(static_cast<int8_t>(value));
+}
+
+static uint64_t ReadVarint(rrlib::serialization::tInputStream& stream)
+{
+  uint64_t result = 0;
+  for (uint shift = 0; shift < 64; shift += 7)
+  {
+    uint8_t byte = static_cast<uint8_t>(stream.ReadByte());
+    result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+    {
+      break;
+    }
+  }
+  return result;
+}
+
+static void WriteSignedVarint(rrlib::serialization::tOutputStream& stream, int64_t value)
+{
+  WriteVarint(stream, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));  // zigzag encoding
+}
+
+static int64_t ReadSignedVarint(rrlib::serialization::tInputStream& stream)
+{
+  uint64_t value = ReadVarint(stream);
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+/*!
+ * \param profile Profile
+ * \param index Index of field
+ * \return Value of field with specified index (durations in nanoseconds)
+ */
+static int64_t GetFieldValue(const tTaskProfile& profile, size_t index)
+{
+  switch (index)
+  {
+  case 0:
+    return profile.last_execution_duration.count();
+  case 1:
+    return profile.max_execution_duration.count();
+  case 2:
+    return profile.average_execution_duration.count();
+  case 3:
+    return profile.total_execution_duration.count();
+  case 4:
+    return profile.last_cpu_time.count();
+  case 5:
+    return profile.last_voluntary_context_switches;
+  case 6:
+    return profile.last_involuntary_context_switches;
+  case 7:
+    return profile.last_minor_page_faults;
+  case 8:
+    return profile.last_major_page_faults;
+  case 9:
+    return static_cast<int64_t>(profile.last_cycles);
+  case 10:
+    return static_cast<int64_t>(profile.last_instructions);
+  case 11:
+    return static_cast<int64_t>(profile.last_cache_misses);
+  default:
+    return static_cast<int64_t>(profile.last_branch_misses);
+  }
+}
+
+/*!
+ * \param profile Profile
+ * \param index Index of field
+ * \param value New value of field with specified index (durations in nanoseconds)
+ */
+static void SetFieldValue(tTaskProfile& profile, size_t index, int64_t value)
+{
+  switch (index)
+  {
+  case 0:
+    profile.last_execution_duration = rrlib::time::tDuration(value);
+    break;
+  case 1:
+    profile.max_execution_duration = rrlib::time::tDuration(value);
+    break;
+  case 2:
+    profile.average_execution_duration = rrlib::time::tDuration(value);
+    break;
+  case 3:
+    profile.total_execution_duration = rrlib::time::tDuration(value);
+    break;
+  case 4:
+    profile.last_cpu_time = rrlib::time::tDuration(value);
+    break;
+  case 5:
+    profile.last_voluntary_context_switches = static_cast<uint32_t>(value);
+    break;
+  case 6:
+    profile.last_involuntary_context_switches = static_cast<uint32_t>(value);
+    break;
+  case 7:
+    profile.last_minor_page_faults = static_cast<uint32_t>(value);
+    break;
+  case 8:
+    profile.last_major_page_faults = static_cast<uint32_t>(value);
+    break;
+  case 9:
+    profile.last_cycles = static_cast<uint64_t>(value);
+    break;
+  case 10:
+    profile.last_instructions = static_cast<uint64_t>(value);
+    break;
+  case 11:
+    profile.last_cache_misses = static_cast<uint64_t>(value);
+    break;
+  default:
+    profile.last_branch_misses = static_cast<uint64_t>(value);
+    break;
+  }
+}
+
+/*!
+ * \param profile Current profile (last execution duration must already be set)
+ * \param last_profile Previous profile
+ * \param index Index of field
+ * \return Predicted value of field with specified index
+ */
+static int64_t Predict(const tTaskProfile& profile, const tTaskProfile& last_profile, size_t index)
+{
+  int64_t last_value = GetFieldValue(last_profile, index);
+  return index == 3 ? last_value + profile.last_execution_duration.count() : last_value;
+}
+
+tTaskProfileEncoder::tTaskProfileEncoder(rrlib::time::tDuration key_frame_period) :
+  key_frame_period(key_frame_period),
+  last_key_frame_time(),
+  key_frame_requested(true),
+  frame_number(0),
+  last_schedule_version(0),
+  last_profiles()
+{
+}
+
+void tTaskProfileEncoder::Encode(rrlib::serialization::tOutputStream& stream, const std::vector<tTaskProfile>& profiles, uint32_t schedule_version,
+                                 const rrlib::time::tTimestamp& time)
+{
+  bool key_frame = key_frame_requested || time - last_key_frame_time >= key_frame_period || time < last_key_frame_time || schedule_version != last_schedule_version || profiles.size() != last_profiles.size();
+  stream.WriteByte(key_frame ? eKEY_FRAME : eDELTA_FRAME);
+  WriteVarint(stream, frame_number);
+  frame_number++;
+  WriteVarint(stream, schedule_version);
+  WriteVarint(stream, profiles.size());
+  if (key_frame)
+  {
+    for (const tTaskProfile & profile : profiles)
+    {
+      WriteVarint(stream, profile.handle);
+      stream.WriteByte(static_cast<int8_t>(profile.task_classification));
+      for (size_t field = 0; field < cFIELD_COUNT; field++)
+      {
+        WriteSignedVarint(stream, GetFieldValue(profile, field));
+      }
+    }
+    key_frame_requested = false;
+    last_key_frame_time = time;
+  }
+  else
+  {
+    for (size_t i = 0; i < profiles.size(); i++)
+    {
+      const tTaskProfile& profile = profiles[i];
+      int64_t deltas[cFIELD_COUNT];
+      uint32_t change_mask = 0;
+      for (size_t field = 0; field < cFIELD_COUNT; field++)
+      {
+        deltas[field] = GetFieldValue(profile, field) - Predict(profile, last_profiles[i], field);
+        change_mask |= (deltas[field] != 0) ? (1 << field) : 0;
+      }
+      WriteVarint(stream, change_mask);
+      for (size_t field = 0; field < cFIELD_COUNT; field++)
+      {
+        if (deltas[field])
+        {
+          WriteSignedVarint(stream, deltas[field]);
+        }
+      }
+    }
+  }
+  last_schedule_version = schedule_version;
+  last_profiles = profiles;
+}
+
+tTaskProfileDecoder::tTaskProfileDecoder() :
+  synchronized(false),
+  last_frame_number(0),
+  last_schedule_version(0),
+  last_profiles()
+{
+}
+
+bool tTaskProfileDecoder::Decode(rrlib::serialization::tInputStream& stream, std::vector<tTaskProfile>& profiles)
+{
+  int8_t frame_type = stream.ReadByte();
+  uint64_t frame_number = ReadVarint(stream);
+  uint32_t schedule_version = static_cast<uint32_t>(ReadVarint(stream));
+  size_t profile_count = static_cast<size_t>(ReadVarint(stream));
+  if (frame_type == eKEY_FRAME)
+  {
+    profiles.resize(profile_count);
+    for (tTaskProfile & profile : profiles)
+    {
+      profile.handle = static_cast<core::tFrameworkElement::tHandle>(ReadVarint(stream));
+      profile.task_classification = static_cast<tTaskClassification>(stream.ReadByte());
+      for (size_t field = 0; field < cFIELD_COUNT; field++)
+      {
+        SetFieldValue(profile, field, ReadSignedVarint(stream));
+      }
+    }
+    synchronized = true;
+  }
+  else
+  {
+    if ((!synchronized) || frame_number != last_frame_number + 1 || schedule_version != last_schedule_version || profile_count != last_profiles.size())
+    {
+      synchronized = false;
+      return false;
+    }
+    profiles.resize(profile_count);
+    for (size_t i = 0; i < profile_count; i++)
+    {
+      tTaskProfile& profile = profiles[i];
+      profile.handle = last_profiles[i].handle;
+      profile.task_classification = last_profiles[i].task_classification;
+      uint32_t change_mask = static_cast<uint32_t>(ReadVarint(stream));
+      for (size_t field = 0; field < cFIELD_COUNT; field++)  // in field order, so that last execution duration is available for predicting total
+      {
+        int64_t delta = (change_mask & (1 << field)) ? ReadSignedVarint(stream) : 0;
+        SetFieldValue(profile, field, Predict(profile, last_profiles[i], field) + delta);
+      }
+    }
+  }
+  last_frame_number = frame_number;
+  last_schedule_version = schedule_version;
+  last_profiles = profiles;
+  return true;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
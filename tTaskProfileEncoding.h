@@ -0,0 +1,198 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tTaskProfileEncoding.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tTaskProfileEncoder and tTaskProfileDecoder
+ *
+ * \b tTaskProfileEncoder and \b tTaskProfileDecoder
+ *
+ * Compact wire format for the task profiles published on a thread container's
+ * execution details port:
+ * Static metadata (handles and classifications) is only sent in key frames -
+ * whenever the schedule changes (and periodically - by default every second - so that receivers can synchronize).
+ * All other frames contain varint-encoded deltas of only the fields that changed.
+ *
+ * Frame format:
+ *   byte:   frame type (key frame or delta frame)
+ *   varint: frame number (incremented with every frame - allows receivers to detect lost frames)
+ *   varint: schedule version
+ *   varint: number of profiles
+ *   key frame, for each profile:   varint handle, byte classification, 13 x zigzag varint field value
+ *   delta frame, for each profile: varint with bit mask of changed fields, zigzag varint delta for each changed field
+ *
+ * Fields are (in this order): last, maximum, average and total execution duration, CPU time of last execution (all in nanoseconds),
+ * voluntary and involuntary context switches, minor and major page faults, CPU cycles, instructions, cache misses and branch misses
+ * (all during last execution - see tTaskProfile).
+ * The total execution duration is predicted to increase by the last execution duration -
+ * so it only counts as changed if it deviates from this prediction.
+ *
+ * As delta frames can only be decoded if the previous frame was received,
+ * receivers should use input ports with queues. After lost frames (or when connecting late), decoding resumes with the next key frame.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tTaskProfileEncoding_h__
+#define __plugins__scheduling__tTaskProfileEncoding_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/serialization/serialization.h"
+#include "rrlib/time/time.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tTaskProfile.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Encodes task profiles to compact wire format
+/*!
+ * Encodes vectors of task profiles (as published on a thread container's execution details port)
+ * to a compact wire format that only contains the changes to the previously encoded vector.
+ * See file description for details on the format.
+ */
+class tTaskProfileEncoder
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param key_frame_period A key frame is encoded at least once in this period
+   *                         (limits how long receivers cannot decode frames after lost frames or after connecting)
+   */
+  tTaskProfileEncoder(rrlib::time::tDuration key_frame_period = std::chrono::seconds(1));
+
+  /*!
+   * Encodes frame with task profiles
+   *
+   * \param stream Stream to write frame to
+   * \param profiles Profiles to encode
+   * \param schedule_version Version of schedule (must change whenever handles or classifications of tasks change)
+   * \param time Current time (to determine whether key frame is due)
+   */
+  void Encode(rrlib::serialization::tOutputStream& stream, const std::vector<tTaskProfile>& profiles, uint32_t schedule_version,
+              const rrlib::time::tTimestamp& time = rrlib::time::Now());
+
+  /*!
+   * Makes sure that next frame will be a key frame
+   */
+  void RequestKeyFrame()
+  {
+    key_frame_requested = true;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! A key frame is encoded at least once in this period */
+  rrlib::time::tDuration key_frame_period;
+
+  /*! Time when last key frame was encoded */
+  rrlib::time::tTimestamp last_key_frame_time;
+
+  /*! Is next frame to be a key frame? (e.g. first frame) */
+  bool key_frame_requested;
+
+  /*! Number of next frame to encode */
+  uint64_t frame_number;
+
+  /*! Schedule version of last encoded frame */
+  uint32_t last_schedule_version;
+
+  /*! Last encoded profiles */
+  std::vector<tTaskProfile> last_profiles;
+};
+
+//! Decodes task profiles from compact wire format
+/*!
+ * Decodes frames created by tTaskProfileEncoder and rebuilds complete vectors of task profiles.
+ */
+class tTaskProfileDecoder
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tTaskProfileDecoder();
+
+  /*!
+   * Decodes frame
+   *
+   * \param stream Stream to read frame from
+   * \param profiles Contains complete vector of task profiles after call (if successful)
+   * \return True if frame could be decoded. False if it is a delta frame and the previous frame was not received (waiting for next key frame).
+   */
+  bool Decode(rrlib::serialization::tInputStream& stream, std::vector<tTaskProfile>& profiles);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Has a key frame been decoded - with no lost frames since then? */
+  bool synchronized;
+
+  /*! Number of last decoded frame */
+  uint64_t last_frame_number;
+
+  /*! Schedule version of last decoded frame */
+  uint32_t last_schedule_version;
+
+  /*! Last decoded profiles */
+  std::vector<tTaskProfile> last_profiles;
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
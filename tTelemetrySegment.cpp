@@ -0,0 +1,237 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tTelemetrySegment.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tTelemetrySegment.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tTelemetrySegment::tTelemetrySegment(tLayout* layout, const std::string& name, bool owner) :
+  layout(layout),
+  name(name),
+  owner(owner)
+{
+}
+
+tTelemetrySegment::~tTelemetrySegment()
+{
+  munmap(layout, sizeof(tLayout));
+  if (owner)
+  {
+    shm_unlink(name.c_str());
+  }
+}
+
+tTelemetrySegment::tContainerSlot* tTelemetrySegment::AcquireSlot()
+{
+  for (size_t i = 0; i < cMAX_CONTAINERS; i++)
+  {
+    uint32_t expected = 0;
+    if (layout->slots[i].in_use.compare_exchange_strong(expected, 1))
+    {
+      tContainerSlot& slot = layout->slots[i];
+      slot.lock.BeginWrite();
+      slot.cycle_count = 0;
+      slot.entry_count = 0;
+      slot.lock.EndWrite();
+      return &slot;
+    }
+  }
+  return nullptr;
+}
+
+void tTelemetrySegment::CopyName(char (&destination)[cMAX_NAME_LENGTH], const std::string& name)
+{
+  size_t length = std::min<size_t>(name.length(), cMAX_NAME_LENGTH - 1);
+  memcpy(destination, name.c_str(), length);
+  destination[length] = 0;
+}
+
+tTelemetrySegment* tTelemetrySegment::GetProcessSegment()
+{
+  static std::mutex mutex;
+  static std::unique_ptr<tTelemetrySegment> segment;
+  static bool creation_failed = false;
+  std::lock_guard<std::mutex> lock(mutex);
+  if (segment || creation_failed)
+  {
+    return segment.get();
+  }
+
+  std::string name = GetSegmentName(getpid());
+  int fd = shm_open(name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    creation_failed = true;
+    return nullptr;
+  }
+  if (ftruncate(fd, sizeof(tLayout)) != 0)
+  {
+    close(fd);
+    shm_unlink(name.c_str());
+    creation_failed = true;
+    return nullptr;
+  }
+  void* memory = mmap(nullptr, sizeof(tLayout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (memory == MAP_FAILED)
+  {
+    shm_unlink(name.c_str());
+    creation_failed = true;
+    return nullptr;
+  }
+
+  // Memory is zero-initialized by ftruncate - so all slots are free and all sequence numbers are zero
+  tLayout* layout = static_cast<tLayout*>(memory);
+  layout->max_containers = cMAX_CONTAINERS;
+  layout->max_tasks = cMAX_TASKS;
+  layout->version = cVERSION;
+  std::atomic_thread_fence(std::memory_order_release);
+  layout->magic = cMAGIC;
+  segment.reset(new tTelemetrySegment(layout, name, true));
+  return segment.get();
+}
+
+std::string tTelemetrySegment::GetSegmentName(pid_t pid)
+{
+  return "/finroc_scheduling_" + std::to_string(pid);
+}
+
+std::unique_ptr<tTelemetrySegment> tTelemetrySegment::Open(pid_t pid)
+{
+  std::string name = GetSegmentName(pid);
+  int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0)
+  {
+    return std::unique_ptr<tTelemetrySegment>();
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) < sizeof(tLayout))
+  {
+    close(fd);
+    return std::unique_ptr<tTelemetrySegment>();
+  }
+  void* memory = mmap(nullptr, sizeof(tLayout), PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (memory == MAP_FAILED)
+  {
+    return std::unique_ptr<tTelemetrySegment>();
+  }
+  tLayout* layout = static_cast<tLayout*>(memory);
+  if (layout->magic != cMAGIC || layout->version != cVERSION || layout->max_containers != cMAX_CONTAINERS || layout->max_tasks != cMAX_TASKS)
+  {
+    munmap(memory, sizeof(tLayout));
+    return std::unique_ptr<tTelemetrySegment>();
+  }
+  return std::unique_ptr<tTelemetrySegment>(new tTelemetrySegment(layout, name, false));
+}
+
+bool tTelemetrySegment::ReadSlot(size_t slot_index, tContainerSnapshot& snapshot) const
+{
+  const tContainerSlot& slot = layout->slots[slot_index];
+  if (!slot.in_use.load(std::memory_order_acquire))
+  {
+    return false;
+  }
+  snapshot.entries.reserve(cMAX_TASKS + 1);
+  for (size_t attempt = 0; attempt < cMAX_READ_ATTEMPTS; attempt++)
+  {
+    uint32_t sequence;
+    if (!slot.lock.TryBeginRead(sequence))
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    snapshot.cycle_count = slot.cycle_count;
+    size_t entry_count = std::min<size_t>(slot.entry_count, cMAX_TASKS + 1);
+    snapshot.entries.resize(entry_count);
+    memcpy(snapshot.entries.data(), slot.entries, entry_count * sizeof(tEntry));
+    if (slot.lock.ValidateRead(sequence))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void tTelemetrySegment::ReleaseSlot(tContainerSlot& slot)
+{
+  slot.lock.BeginWrite();
+  slot.entry_count = 0;
+  slot.lock.EndWrite();
+  slot.in_use.store(0, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,241 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tTelemetrySegment.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tTelemetrySegment
+ *
+ * \b tTelemetrySegment
+ *
+ * POSIX shared memory segment with live profiles of the thread containers in a process.
+ * Thread containers write their profiles to the segment without blocking (protected by
+ * sequence locks). Other processes can read them without connecting to the runtime
+ * and without adding load to the real-time threads.
+ *
+ * This class has no dependencies on the rest of Finroc, so that reader tools
+ * can be kept lightweight.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tTelemetrySegment_h__
+#define __plugins__scheduling__tTelemetrySegment_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tSequenceLock.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Shared memory segment with live task profiles
+/*!
+ * POSIX shared memory segment with live profiles of the thread containers in a process.
+ * Thread containers write their profiles to the segment without blocking (protected by
+ * sequence locks). Other processes can read them without connecting to the runtime
+ * and without adding load to the real-time threads.
+ *
+ * There is at most one segment per process. Its name is "/finroc_scheduling_<pid>".
+ */
+class tTelemetrySegment
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  enum
+  {
+    cMAX_CONTAINERS = 64,       //!< Maximum number of thread containers in segment
+    cMAX_TASKS = 512,           //!< Maximum number of tasks per thread container (additional tasks are not included)
+    cMAX_NAME_LENGTH = 48,      //!< Maximum length of names (including terminating zero - longer names are truncated)
+    cMAX_READ_ATTEMPTS = 10000  //!< Maximum number of attempts to read a consistent copy of a container slot (see ReadSlot())
+  };
+
+  /*! Magic number at the beginning of segment ("FRTS") */
+  static const uint32_t cMAGIC = 0x53545246;
+
+  /*! Version of segment layout */
+  static const uint32_t cVERSION = 1;
+
+  /*! Profile of a thread container or task in segment (durations are in nanoseconds) */
+  struct tEntry
+  {
+    /*! Handle of framework element associated with container or task */
+    uint32_t handle;
+
+    /*! Classification of task (numeric value of tTaskClassification) */
+    uint32_t task_classification;
+
+    int64_t last_execution_duration;
+    int64_t max_execution_duration;
+    int64_t average_execution_duration;
+    int64_t total_execution_duration;
+
+    /*! Name of container or task */
+    char name[cMAX_NAME_LENGTH];
+  };
+
+  /*! Slot of one thread container in segment */
+  struct tContainerSlot
+  {
+    /*! Non-zero if slot is used by a thread container */
+    std::atomic<uint32_t> in_use;
+
+    /*! Protects all following fields */
+    tSequenceLock lock;
+
+    /*! Number of profiled cycles */
+    uint64_t cycle_count;
+
+    /*! Number of valid entries in 'entries' */
+    uint32_t entry_count;
+
+    /*!
+     * The first element contains the profile of the whole thread container.
+     * The other elements contain the profiles of the executed tasks - in the order of their execution
+     */
+    tEntry entries[cMAX_TASKS + 1];
+  };
+
+  /*! Consistent copy of a container slot (obtained by readers) */
+  struct tContainerSnapshot
+  {
+    uint64_t cycle_count;
+    std::vector<tEntry> entries;
+  };
+
+  ~tTelemetrySegment();
+
+  /*!
+   * Copies string to fixed-size name buffer in segment (truncating it if necessary)
+   *
+   * \param destination Name buffer in segment
+   * \param name Name to copy
+   */
+  static void CopyName(char (&destination)[cMAX_NAME_LENGTH], const std::string& name);
+
+  /*!
+   * \return Segment of this process (created on first call) - nullptr if shared memory segment could not be created
+   */
+  static tTelemetrySegment* GetProcessSegment();
+
+  /*!
+   * \param pid Process id
+   * \return Name of shared memory segment of process with specified id
+   */
+  static std::string GetSegmentName(pid_t pid);
+
+  /*!
+   * Opens segment of another process for reading (read-only)
+   *
+   * \param pid Process id
+   * \return Segment - nullptr if it does not exist or is incompatible
+   */
+  static std::unique_ptr<tTelemetrySegment> Open(pid_t pid);
+
+  /*!
+   * Obtains free container slot to write to
+   *
+   * \return Container slot - nullptr if no slot is available
+   */
+  tContainerSlot* AcquireSlot();
+
+  /*!
+   * Reads consistent copy of container slot
+   *
+   * \param slot_index Index of slot
+   * \param snapshot Object to copy slot's content to
+   * \return False if slot is not in use - or if no consistent copy could be obtained within cMAX_READ_ATTEMPTS attempts
+   *         (e.g. because the writing process terminated while writing)
+   */
+  bool ReadSlot(size_t slot_index, tContainerSnapshot& snapshot) const;
+
+  /*!
+   * Releases container slot obtained with AcquireSlot()
+   *
+   * \param slot Slot to release
+   */
+  void ReleaseSlot(tContainerSlot& slot);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Layout of segment */
+  struct tLayout
+  {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t max_containers;
+    uint32_t max_tasks;
+    tContainerSlot slots[cMAX_CONTAINERS];
+  };
+
+  /*! Mapped segment */
+  tLayout* layout;
+
+  /*! Name of segment */
+  std::string name;
+
+  /*! True if this object created segment (it is unlinked on destruction) */
+  bool owner;
+
+  tTelemetrySegment(tLayout* layout, const std::string& name, bool owner);
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -83,6 +83,60 @@ public:
   /*! Warn on cycle time exceed */
   parameters::tStaticParameter<bool> warn_on_cycle_time_exceed;
 
+  /*! Number of completed cycles the flight recorder keeps and dumps (see tFlightRecorder) - zero disables the flight recorder */
+  parameters::tStaticParameter<unsigned int> flight_recorder_cycles;
+
+  /*! Flight recorder dump is triggered when execution of a cycle exceeds the cycle time by this fraction (e.g. 0.5 for 50%) - negative values disable this trigger */
+  parameters::tStaticParameter<double> flight_recorder_overrun_threshold;
+
+  /*! Directory that flight recorder dumps are written to */
+  parameters::tStaticParameter<std::string> flight_recorder_directory;
+
+  /*!
+   * Start cycles precisely: sleep until shortly before cycle start - and then busy-wait.
+   * Reduces wake-up jitter significantly at the cost of CPU time spent busy-waiting (published via spin_duration port).
+   */
+  parameters::tStaticParameter<bool> precise_wait;
+
+  /*! Initial (and minimum) margin to busy-wait for in precise wait mode (tuned automatically from observed wake-up latency) */
+  parameters::tStaticParameter<rrlib::time::tDuration> precise_wait_margin;
+
+  /*! Order independent tasks so that consumers are executed as close as possible after their producers (improves cache locality) */
+  parameters::tStaticParameter<bool> locality_aware_ordering;
+
+  /*!
+   * Execute non-critical tasks (those not in initial, sense or control set) in a separate companion thread with normal priority -
+   * so that timing of the critical tasks does not depend on them
+   */
+  parameters::tStaticParameter<bool> mixed_criticality;
+
+  /*!
+   * Time-triggered mode: after calibration, each task is released exactly at a static offset within the cycle
+   * (computed from measured execution durations) - instead of back to back
+   */
+  parameters::tStaticParameter<bool> time_triggered;
+
+  /*! Number of cycles to measure execution durations before release table is computed in time-triggered mode */
+  parameters::tStaticParameter<unsigned int> time_triggered_calibration_cycles;
+
+  /*! Relative margin added to maximum measured execution duration of each task to obtain its budget in time-triggered mode */
+  parameters::tStaticParameter<double> time_triggered_budget_margin;
+
+  /*! Maintain execution statistics that can be obtained from any thread via GetStatisticsSnapshot() */
+  parameters::tStaticParameter<bool> statistics_snapshots;
+
+  /*!
+   * Offset of first cycle relative to common start time when started synchronized with other containers (see tExecutionControl::StartAll).
+   * With the default of zero, all containers begin their cycles at the same instant - set offsets to spread them over the cycle.
+   */
+  parameters::tStaticParameter<rrlib::time::tDuration> phase_offset;
+
+  /*! Background jobs are stopped this duration before the next cycle is due to start (see AddBackgroundJob()) */
+  parameters::tStaticParameter<rrlib::time::tDuration> background_job_safety_margin;
+
+  /*! Number of cycles in sliding window for minimum, average and maximum utilization (see utilization port) */
+  parameters::tStaticParameter<unsigned int> utilization_window;
+
   /*! Port to publish time spent in last call to MainLoopCallback() */
   data_ports::tOutputPort<rrlib::time::tDuration> execution_duration;
 
@@ -90,9 +144,35 @@ public:
    * Port to publish details on execution (port is only created if profiling is enabled)
    * The first element contains the profile the whole thread container.
    * The other elements contain the profile the executed tasks - in the order of their execution
+   * (when serialized, e.g. for remote receivers, profiles contain only execution durations - see tTaskProfile)
    */
   data_ports::tOutputPort<std::vector<tTaskProfile>> execution_details;
 
+  /*!
+   * Port to publish details on execution in compact delta encoding (port is only created if profiling is enabled)
+   * Can be decoded to the same vectors as published via execution_details using tTaskProfileDecoder
+   * (including resource usage and performance counter values).
+   */
+  data_ports::tOutputPort<rrlib::serialization::tMemoryBuffer> execution_details_compact;
+
+  /*! Port to publish utilization and headroom of thread container (published every cycle - also if profiling is disabled) */
+  data_ports::tOutputPort<tUtilization> utilization;
+
+  /*! Port to publish how often the schedule has been rebuilt (e.g. to check the effect of tStructureBatch) */
+  data_ports::tOutputPort<unsigned int> reschedule_count;
+
+  /*! Port to publish execution duration of non-critical tasks in mixed-criticality mode (only created in this mode - see CreateOptionalPorts()) */
+  data_ports::tOutputPort<rrlib::time::tDuration> non_critical_execution_duration;
+
+  /*! Port to publish number of cycles skipped by companion thread in mixed-criticality mode (as it had not completed the previous cycle - only created in this mode) */
+  data_ports::tOutputPort<unsigned int> non_critical_overruns;
+
+  /*! Port to publish number of tasks that could not be released at their offset in time-triggered mode (only created in this mode - see CreateOptionalPorts()) */
+  data_ports::tOutputPort<unsigned int> release_offset_violations;
+
+  /*! Port to publish time spent busy-waiting for cycle start in precise wait mode (only created in this mode - see CreateOptionalPorts()) */
+  data_ports::tOutputPort<rrlib::time::tDuration> spin_duration;
+
 
   /*!
    * All constructor parameters are forwarded to class BASE (usually parent, name, flags)
@@ -102,12 +182,20 @@ public:
 
   virtual ~tThreadContainerElement();
 
+  /*!
+   * Adds background job that is executed in the slack at the end of each cycle (see tBackgroundJob).
+   * Jobs are executed round-robin until shortly before the next cycle is due to start.
+   *
+   * \param job Job to add (must exist until it is removed or returns false in ExecuteSlice())
+   */
+  void AddBackgroundJob(tBackgroundJob& job);
+
   /*!
    * Execute one cycle manually.
    * This can be handy for test programs (e.g. for accelerating them)
    * and is not meant for "normal" applications.
    *
-   * StartExecution() must not be called when using this method.
+   * Execution must not be running when using this method (it may be paused, however - see PauseExecution()).
    */
   void ExecuteCycle();
 
@@ -119,9 +207,37 @@ public:
     return cycle_time.Get();
   }
 
+  virtual rrlib::time::tDuration GetPhaseOffset() override
+  {
+    return phase_offset.Get();
+  }
+
   virtual bool IsExecuting() override
   {
-    return thread.get();
+    return thread.get() && thread->IsAlive() && (!thread->IsPauseRequested());
+  }
+
+  /*!
+   * Copies current execution statistics of thread container and its tasks
+   * (without blocking the thread container thread - see tThreadContainerThread::GetStatisticsSnapshot()).
+   * Requires that the "Statistics Snapshots" parameter is set.
+   *
+   * \param snapshot Object to copy statistics to (reusing its memory)
+   * \return False if thread container has not been started yet (snapshot is not modified in this case)
+   */
+  bool GetStatisticsSnapshot(tStatisticsSnapshot& snapshot)
+  {
+    std::shared_ptr<tThreadContainerThread> current_thread;
+    {
+      rrlib::thread::tLock l(mutex);
+      current_thread = thread;
+    }
+    if (!current_thread)
+    {
+      return false;
+    }
+    current_thread->GetStatisticsSnapshot(snapshot);
+    return true;
   }
 
   /*!
@@ -129,12 +245,43 @@ public:
    */
   void JoinThread();
 
-  virtual void PauseExecution() override
+  /*!
+   * Requests that flight recorder writes the recorded cycles to a file
+   * (at the end of the current cycle - if flight recorder is enabled and thread is executing)
+   */
+  void RequestFlightRecorderDump()
   {
-    StopThread();
-    JoinThread();
+    rrlib::thread::tLock l(mutex);
+    if (thread)
+    {
+      thread->RequestFlightRecorderDump();
+    }
   }
 
+  /*!
+   * Pauses execution after the current cycle (blocks until this cycle is complete).
+   * The thread is kept (parked) - together with its schedule - so that
+   * StartExecution() can resume quickly.
+   */
+  virtual void PauseExecution() override;
+
+  /*!
+   * Creates and starts thread in paused state - so that StartExecution() merely needs to wake it up
+   */
+  virtual void PrepareExecution() override;
+
+  /*!
+   * Removes background job (blocks if job is currently executing)
+   *
+   * \param job Job to remove
+   */
+  void RemoveBackgroundJob(tBackgroundJob& job);
+
+  /*!
+   * Requests that execution is paused after the current cycle (does not block)
+   */
+  virtual void RequestPause() override;
+
   /*!
    * \param period Cycle time
    */
@@ -151,8 +298,26 @@ public:
     SetCycleTime(std::chrono::milliseconds(period));
   }
 
+  /*!
+   * Starts execution - or resumes it, if it was paused
+   * (thread and schedule are reused in this case - rescheduling is only performed if relevant structure changed meanwhile).
+   * If static parameters were changed while execution was paused, a new thread is created instead - so that they take effect.
+   */
   virtual void StartExecution() override;
 
+  /*!
+   * Starts (or resumes) execution - with the first cycle beginning at the specified time.
+   * Returns immediately: the thread itself waits for the start time (see tExecutionControl::StartAll()).
+   *
+   * \param start_time Time at which first cycle is to begin
+   */
+  virtual void StartExecutionAt(const rrlib::time::tTimestamp& start_time) override;
+
+  /*!
+   * Blocks until current cycle is complete after RequestPause() was called
+   */
+  virtual void WaitUntilPaused() override;
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
@@ -161,12 +326,84 @@ private:
   /*! Thread cycle time */
   parameters::tStaticParameter<rrlib::time::tDuration> cycle_time;
 
-  /*! Thread - while program is running - in pause mode null */
+  /*!
+   * Values of static parameters that the thread is created with.
+   * CreateThread() takes all parameter values from this struct - so a parameter added here (and to operator==)
+   * is automatically considered when checking whether a parked thread needs to be replaced (see DiscardThreadIfReconfigured()).
+   */
+  struct tThreadConfiguration
+  {
+    rrlib::time::tDuration cycle_time;
+    bool rt_thread;
+    bool warn_on_cycle_time_exceed;
+    unsigned int flight_recorder_cycles;
+    double flight_recorder_overrun_threshold;
+    std::string flight_recorder_directory;
+    bool precise_wait;
+    rrlib::time::tDuration precise_wait_margin;
+    bool locality_aware_ordering;
+    bool mixed_criticality;
+    bool time_triggered;
+    unsigned int time_triggered_calibration_cycles;
+    double time_triggered_budget_margin;
+    bool statistics_snapshots;
+    rrlib::time::tDuration background_job_safety_margin;
+    unsigned int utilization_window;
+
+    bool operator==(const tThreadConfiguration& other) const
+    {
+      return cycle_time == other.cycle_time && rt_thread == other.rt_thread && warn_on_cycle_time_exceed == other.warn_on_cycle_time_exceed &&
+             flight_recorder_cycles == other.flight_recorder_cycles && flight_recorder_overrun_threshold == other.flight_recorder_overrun_threshold &&
+             flight_recorder_directory == other.flight_recorder_directory && precise_wait == other.precise_wait && precise_wait_margin == other.precise_wait_margin &&
+             locality_aware_ordering == other.locality_aware_ordering && mixed_criticality == other.mixed_criticality && time_triggered == other.time_triggered &&
+             time_triggered_calibration_cycles == other.time_triggered_calibration_cycles && time_triggered_budget_margin == other.time_triggered_budget_margin &&
+             statistics_snapshots == other.statistics_snapshots && background_job_safety_margin == other.background_job_safety_margin &&
+             utilization_window == other.utilization_window;
+    }
+
+    bool operator!=(const tThreadConfiguration& other) const
+    {
+      return !(*this == other);
+    }
+  };
+
+  /*! Thread - null before execution is started (parked while execution is paused) */
   std::shared_ptr<tThreadContainerThread> thread;
 
+  /*! Static parameter values that current thread was created with */
+  tThreadConfiguration thread_configuration;
+
+  /*! Background jobs added to this thread container (passed to thread when it is created) */
+  std::vector<tBackgroundJob*> background_jobs;
+
   /*! Mutex for operations on thread container */
   rrlib::thread::tOrderedMutex mutex;
 
+  /*!
+   * Creates ports that are only needed in modes enabled via static parameters (e.g. "Spin Duration" in precise wait mode) - if they do not exist yet.
+   * These ports cannot be created in the constructor, as static parameter values are loaded after construction.
+   * Must be called before mutex is locked (locks runtime's structure mutex).
+   */
+  void CreateOptionalPorts();
+
+  /*!
+   * Creates thread for thread container with current parameter values
+   * (mutex must be locked)
+   */
+  void CreateThread();
+
+  /*!
+   * \return Current values of static parameters relevant for thread
+   */
+  tThreadConfiguration GetThreadConfiguration();
+
+  /*!
+   * Discards parked thread if static parameters changed while execution was paused
+   * (so that a new thread is created with the current values - as they are only applied when creating the thread).
+   * Mutex must be locked.
+   */
+  void DiscardThreadIfReconfigured();
+
   /*!
    * Stop thread in thread container (does not block - call join thread to block until thread has terminated)
    */
@@ -32,12 +32,15 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include "core/tLockOrderLevel.h"
+#include <algorithm>
+#include <tuple>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/scheduling/scheduling.h"
 #include "plugins/scheduling/tExecutionControl.h"
+#include "plugins/scheduling/tPeriodicFrameworkElementTask.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -70,10 +73,33 @@ tThreadContainerElement<BASE>::tThreadContainerElement(ARGS && ... args) :
   BASE(args...),
   rt_thread("Realtime Thread", this, false),
   warn_on_cycle_time_exceed("Warn on cycle time exceed", this, true),
+  flight_recorder_cycles("Flight Recorder Cycles", this, 0),
+  flight_recorder_overrun_threshold("Flight Recorder Overrun Threshold", this, 0.5),
+  flight_recorder_directory("Flight Recorder Directory", this, "."),
+  precise_wait("Precise Wait", this, false),
+  precise_wait_margin("Precise Wait Margin", this, std::chrono::microseconds(200)),
+  locality_aware_ordering("Locality-Aware Ordering", this, false),
+  mixed_criticality("Mixed Criticality", this, false),
+  time_triggered("Time-Triggered", this, false),
+  time_triggered_calibration_cycles("Time-Triggered Calibration Cycles", this, 100),
+  time_triggered_budget_margin("Time-Triggered Budget Margin", this, 0.25),
+  statistics_snapshots("Statistics Snapshots", this, false),
+  phase_offset("Phase Offset", this, rrlib::time::tDuration::zero()),
+  background_job_safety_margin("Background Job Safety Margin", this, std::chrono::microseconds(500)),
+  utilization_window("Utilization Window", this, 250, data_ports::tBounds<unsigned int>(1, 100000)),
   execution_duration("Execution Duration", new core::tFrameworkElement(this, "Profiling")),
   execution_details("Details", execution_duration.GetParent(), IsProfilingEnabled() ? BASE::tFlag::PORT : BASE::tFlag::DELETED),
+  execution_details_compact("Compact Details", execution_duration.GetParent(), IsProfilingEnabled() ? BASE::tFlag::PORT : BASE::tFlag::DELETED),
+  utilization("Utilization", execution_duration.GetParent()),
+  reschedule_count("Reschedule Count", execution_duration.GetParent()),
+  non_critical_execution_duration(),
+  non_critical_overruns(),
+  release_offset_violations(),
+  spin_duration(),
   cycle_time("Cycle Time", this, std::chrono::milliseconds(40), data_ports::tBounds<rrlib::time::tDuration>(rrlib::time::tDuration::zero(), std::chrono::seconds(60))),
   thread(),
+  thread_configuration(),
+  background_jobs(),
   mutex("tThreadContainerElement", static_cast<int>(core::tLockOrderLevel::RUNTIME_REGISTER) - 1)
 {
   this->AddAnnotation(*new tExecutionControl(*this));
@@ -87,6 +113,100 @@ tThreadContainerElement<BASE>::~tThreadContainerElement()
     StopThread();
     JoinThread();
   }
+  tPeriodicFrameworkElementTask::HandBackMigratedTasks(*this);
+}
+
+template <typename BASE>
+void tThreadContainerElement<BASE>::AddBackgroundJob(tBackgroundJob& job)
+{
+  rrlib::thread::tLock l(mutex);
+  if (std::find(background_jobs.begin(), background_jobs.end(), &job) == background_jobs.end())
+  {
+    background_jobs.push_back(&job);
+  }
+  if (thread)
+  {
+    thread->AddBackgroundJob(job);
+  }
+}
+
+template <typename BASE>
+void tThreadContainerElement<BASE>::CreateOptionalPorts()
+{
+  if (((!precise_wait.Get()) || spin_duration.GetWrapped()) && ((!mixed_criticality.Get()) || non_critical_execution_duration.GetWrapped()) &&
+      ((!time_triggered.Get()) || release_offset_violations.GetWrapped()))
+  {
+    return;  // common case (e.g. when resuming)
+  }
+  rrlib::thread::tLock l(this->GetStructureMutex());
+  if (precise_wait.Get() && (!spin_duration.GetWrapped()))
+  {
+    spin_duration = data_ports::tOutputPort<rrlib::time::tDuration>("Spin Duration", execution_duration.GetParent());
+    spin_duration.Init();
+  }
+  if (mixed_criticality.Get() && (!non_critical_execution_duration.GetWrapped()))
+  {
+    non_critical_execution_duration = data_ports::tOutputPort<rrlib::time::tDuration>("Non-Critical Execution Duration", execution_duration.GetParent());
+    non_critical_execution_duration.Init();
+    non_critical_overruns = data_ports::tOutputPort<unsigned int>("Non-Critical Overruns", execution_duration.GetParent());
+    non_critical_overruns.Init();
+  }
+  if (time_triggered.Get() && (!release_offset_violations.GetWrapped()))
+  {
+    release_offset_violations = data_ports::tOutputPort<unsigned int>("Release Offset Violations", execution_duration.GetParent());
+    release_offset_violations.Init();
+  }
+}
+
+template <typename BASE>
+void tThreadContainerElement<BASE>::CreateThread()
+{
+  thread_configuration = GetThreadConfiguration();
+  const tThreadConfiguration& config = thread_configuration;
+  tThreadContainerThread* thread_tmp = new tThreadContainerThread(*this, config.cycle_time, config.warn_on_cycle_time_exceed, execution_duration, execution_details, execution_details_compact);
+  thread_tmp->SetAutoDelete();
+  thread = std::static_pointer_cast<tThreadContainerThread>(thread_tmp->GetSharedPtr());
+  if (config.flight_recorder_cycles > 0)
+  {
+    thread->EnableFlightRecorder(config.flight_recorder_cycles, config.flight_recorder_overrun_threshold, config.flight_recorder_directory);
+  }
+  thread->SetLocalityAwareOrdering(config.locality_aware_ordering);
+  if (config.precise_wait)
+  {
+    thread->EnablePreciseWait(config.precise_wait_margin, spin_duration);
+  }
+  thread->EnableUtilizationMonitoring(config.utilization_window, utilization);
+  if (config.mixed_criticality)
+  {
+    thread->EnableMixedCriticality(non_critical_execution_duration, non_critical_overruns);
+  }
+  if (config.time_triggered)
+  {
+    thread->EnableTimeTriggeredMode(config.time_triggered_calibration_cycles, config.time_triggered_budget_margin, release_offset_violations);
+  }
+  if (config.statistics_snapshots)
+  {
+    thread->EnableStatisticsSnapshots();
+  }
+  thread->SetRescheduleCountPort(reschedule_count);
+  thread->SetBackgroundJobSafetyMargin(config.background_job_safety_margin);
+  for (tBackgroundJob * job : background_jobs)
+  {
+    thread->AddBackgroundJob(*job);
+  }
+}
+
+template <typename BASE>
+void tThreadContainerElement<BASE>::DiscardThreadIfReconfigured()
+{
+  if (thread && thread->IsAlive() && thread->IsPauseRequested() && thread_configuration != GetThreadConfiguration())
+  {
+    FINROC_LOG_PRINT(DEBUG, "Static parameters changed while paused. Creating new thread.");
+    thread->StopThread();
+    thread->Resume();  // wake up parked thread, so that it can terminate
+    thread->Join();
+    thread.reset();
+  }
 }
 
 template <typename BASE>
@@ -94,19 +214,41 @@ void tThreadContainerElement<BASE>::ExecuteCycle()
 {
   if (!thread.get())
   {
+    CreateOptionalPorts();
     rrlib::thread::tLock l(mutex);
-    tThreadContainerThread* thread_tmp = new tThreadContainerThread(*this, cycle_time.Get(), warn_on_cycle_time_exceed.Get(), execution_duration, execution_details);
-    thread_tmp->SetAutoDelete();
-    thread = std::static_pointer_cast<tThreadContainerThread>(thread_tmp->GetSharedPtr());
+    CreateThread();
     thread->StopThread();
     thread->Start();
     thread->Join();
   }
   else
   {
-    assert(!thread->IsAlive());
+    assert((!thread->IsAlive()) || thread->IsPauseRequested());
   }
-  thread->MainLoopCallback();
+  thread->ExecuteCycle();  // also works if thread is paused
+}
+
+template <typename BASE>
+typename tThreadContainerElement<BASE>::tThreadConfiguration tThreadContainerElement<BASE>::GetThreadConfiguration()
+{
+  tThreadConfiguration config;
+  config.cycle_time = cycle_time.Get();
+  config.rt_thread = rt_thread.Get();
+  config.warn_on_cycle_time_exceed = warn_on_cycle_time_exceed.Get();
+  config.flight_recorder_cycles = flight_recorder_cycles.Get();
+  config.flight_recorder_overrun_threshold = flight_recorder_overrun_threshold.Get();
+  config.flight_recorder_directory = flight_recorder_directory.Get();
+  config.precise_wait = precise_wait.Get();
+  config.precise_wait_margin = precise_wait_margin.Get();
+  config.locality_aware_ordering = locality_aware_ordering.Get();
+  config.mixed_criticality = mixed_criticality.Get();
+  config.time_triggered = time_triggered.Get();
+  config.time_triggered_calibration_cycles = time_triggered_calibration_cycles.Get();
+  config.time_triggered_budget_margin = time_triggered_budget_margin.Get();
+  config.statistics_snapshots = statistics_snapshots.Get();
+  config.background_job_safety_margin = background_job_safety_margin.Get();
+  config.utilization_window = utilization_window.Get();
+  return config;
 }
 
 template <typename BASE>
@@ -120,26 +262,101 @@ void tThreadContainerElement<BASE>::JoinThread()
   }
 }
 
+template <typename BASE>
+void tThreadContainerElement<BASE>::PauseExecution()
+{
+  rrlib::thread::tLock l(mutex);
+  if (thread && thread->IsAlive())
+  {
+    thread->RequestPause();
+    thread->WaitUntilPaused();
+  }
+}
+
+template <typename BASE>
+void tThreadContainerElement<BASE>::PrepareExecution()
+{
+  CreateOptionalPorts();
+  rrlib::thread::tLock l(mutex);
+  DiscardThreadIfReconfigured();
+  if (thread)
+  {
+    return;
+  }
+  CreateThread();
+  if (thread_configuration.rt_thread)
+  {
+    thread->SetRealtime();
+  }
+  thread->RequestPause();
+  l.Unlock();
+  thread->Start();
+}
+
+template <typename BASE>
+void tThreadContainerElement<BASE>::RemoveBackgroundJob(tBackgroundJob& job)
+{
+  rrlib::thread::tLock l(mutex);
+  background_jobs.erase(std::remove(background_jobs.begin(), background_jobs.end(), &job), background_jobs.end());
+  if (thread)
+  {
+    thread->RemoveBackgroundJob(job);
+  }
+}
+
+template <typename BASE>
+void tThreadContainerElement<BASE>::RequestPause()
+{
+  rrlib::thread::tLock l(mutex);
+  if (thread && thread->IsAlive())
+  {
+    thread->RequestPause();
+  }
+}
+
 template <typename BASE>
 void tThreadContainerElement<BASE>::StartExecution()
 {
+  StartExecutionAt(rrlib::time::cNO_TIME);
+}
+
+template <typename BASE>
+void tThreadContainerElement<BASE>::StartExecutionAt(const rrlib::time::tTimestamp& start_time)
+{
+  CreateOptionalPorts();
   rrlib::thread::tLock l(mutex);
+  DiscardThreadIfReconfigured();
+  if (thread && thread->IsPauseRequested())  // paused or prepared (see PrepareExecution())
+  {
+    thread->SetStartTime(start_time);
+    thread->Resume();
+    return;
+  }
   if (thread)
   {
     FINROC_LOG_PRINT(WARNING, "Thread is already executing.");
     return;
   }
-  tThreadContainerThread* thread_tmp = new tThreadContainerThread(*this, cycle_time.Get(), warn_on_cycle_time_exceed.Get(), execution_duration, execution_details);
-  thread_tmp->SetAutoDelete();
-  thread = std::static_pointer_cast<tThreadContainerThread>(thread_tmp->GetSharedPtr());
-  if (rt_thread.Get())
+  CreateThread();
+  if (thread_configuration.rt_thread)
   {
-    thread_tmp->SetRealtime();
+    thread->SetRealtime();
   }
+  thread->SetStartTime(start_time);
   l.Unlock();
   thread->Start();
 }
 
+template <typename BASE>
+void tThreadContainerElement<BASE>::WaitUntilPaused()
+{
+  rrlib::thread::tLock l(mutex);
+  if (thread && thread->IsAlive())
+  {
+    thread->WaitUntilPaused();
+  }
+}
+
 template <typename BASE>
 void tThreadContainerElement<BASE>::StopThread()
 {
@@ -147,6 +364,10 @@ void tThreadContainerElement<BASE>::StopThread()
   if (thread)
   {
     thread->StopThread();
+    if (thread->IsPauseRequested())
+    {
+      thread->Resume();  // wake up parked thread, so that it can terminate
+    }
   }
 }
 
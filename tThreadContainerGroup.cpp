@@ -0,0 +1,255 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tThreadContainerGroup.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tThreadContainerGroup.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tThread.h"
+#include "rrlib/thread/tLock.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+/*! Worker thread that executes members of group in parallel */
+class tThreadContainerGroup::tWorkerThread : public rrlib::thread::tThread
+{
+public:
+
+  tWorkerThread(tThreadContainerGroup& group, size_t thread_index) :
+    group(group),
+    thread_index(thread_index),
+    executed_tick_count(group.started_tick_count)
+  {
+    this->SetName("Thread Container Group Worker " + std::to_string(thread_index));
+  }
+
+  virtual void Run() override
+  {
+    while (true)
+    {
+      {
+        rrlib::thread::tLock lock(group.mutex);
+        while (executed_tick_count == group.started_tick_count && (!IsStopSignalSet()))
+        {
+          group.tick_signal.Wait(lock);
+        }
+        if (IsStopSignalSet())
+        {
+          return;
+        }
+      }
+
+      group.ExecuteMembers(thread_index);
+
+      rrlib::thread::tLock lock(group.mutex);
+      executed_tick_count = group.started_tick_count;
+      group.completed_worker_count++;
+      group.tick_signal.NotifyAll(lock);
+    }
+  }
+
+  virtual void StopThreadImplementation() override
+  {
+    rrlib::thread::tLock lock(group.mutex);
+    group.tick_signal.NotifyAll(lock);
+  }
+
+private:
+
+  tThreadContainerGroup& group;
+
+  /*! Index of this thread (workers start at 1) */
+  const size_t thread_index;
+
+  /*! Number of ticks this worker has executed (compared to tThreadContainerGroup::started_tick_count) */
+  uint64_t executed_tick_count;
+};
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tThreadContainerGroup::tThreadContainerGroup(size_t worker_thread_count, bool virtual_time, const rrlib::time::tTimestamp& start_time) :
+  members(),
+  tick_duration(rrlib::time::tDuration::zero()),
+  tick_count(0),
+  virtual_time(virtual_time),
+  previous_time_mode(rrlib::time::GetTimeMode()),
+  time(start_time == rrlib::time::cNO_TIME ? rrlib::time::Now() : start_time),
+  worker_threads(),
+  mutex(),
+  tick_signal(mutex),
+  started_tick_count(0),
+  completed_worker_count(0)
+{
+  if (virtual_time)
+  {
+    rrlib::time::SetTimeMode(rrlib::time::tTimeMode::CUSTOM_CLOCK);
+    rrlib::time::SetTime(time);
+  }
+  for (size_t i = 0; i < worker_thread_count; i++)
+  {
+    tWorkerThread* worker = new tWorkerThread(*this, i + 1);
+    worker->SetAutoDelete();
+    worker_threads.push_back(std::static_pointer_cast<tWorkerThread>(worker->GetSharedPtr()));
+    worker->Start();
+  }
+}
+
+tThreadContainerGroup::~tThreadContainerGroup()
+{
+  for (auto & worker : worker_threads)
+  {
+    worker->StopThread();
+  }
+  for (auto & worker : worker_threads)
+  {
+    worker->Join();
+  }
+  if (virtual_time)
+  {
+    rrlib::time::SetTimeMode(previous_time_mode);
+  }
+}
+
+void tThreadContainerGroup::AddMember(const rrlib::time::tDuration& cycle_time, const std::function<void()>& execute_cycle)
+{
+  assert(cycle_time > rrlib::time::tDuration::zero());
+  members.push_back(tMember { cycle_time, execute_cycle, 1 });
+
+  // Tick duration is greatest common divisor of all cycle times
+  rrlib::time::tDuration::rep a = cycle_time.count(), b = tick_duration.count();
+  while (b != 0)
+  {
+    rrlib::time::tDuration::rep remainder = a % b;
+    a = b;
+    b = remainder;
+  }
+  tick_duration = rrlib::time::tDuration(a);
+  for (tMember & member : members)
+  {
+    member.tick_divisor = member.cycle_time / tick_duration;
+  }
+}
+
+void tThreadContainerGroup::ExecuteMembers(size_t thread_index)
+{
+  size_t thread_count = worker_threads.size() + 1;
+  for (size_t i = thread_index; i < members.size(); i += thread_count)
+  {
+    if (tick_count % members[i].tick_divisor == 0)
+    {
+      members[i].execute_cycle();
+    }
+  }
+}
+
+void tThreadContainerGroup::ExecuteTick()
+{
+  if (virtual_time)
+  {
+    rrlib::time::SetTime(time);
+  }
+
+  if (worker_threads.empty())
+  {
+    ExecuteMembers(0);
+  }
+  else
+  {
+    {
+      rrlib::thread::tLock lock(mutex);
+      completed_worker_count = 0;
+      started_tick_count++;
+      tick_signal.NotifyAll(lock);
+    }
+    ExecuteMembers(0);
+
+    // Barrier: wait until all worker threads have completed tick
+    rrlib::thread::tLock lock(mutex);
+    while (completed_worker_count < worker_threads.size())
+    {
+      tick_signal.Wait(lock);
+    }
+  }
+
+  tick_count++;
+  time += tick_duration;
+}
+
+void tThreadContainerGroup::Run(const rrlib::time::tDuration& duration)
+{
+  rrlib::time::tTimestamp end = time + duration;
+  while (time < end)
+  {
+    if (!virtual_time)
+    {
+      rrlib::time::tDuration wait = time - rrlib::time::Now();
+      if (wait > rrlib::time::tDuration::zero())
+      {
+        rrlib::thread::tThread::Sleep(wait, false);
+      }
+    }
+    ExecuteTick();
+  }
+}
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,231 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tThreadContainerGroup.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tThreadContainerGroup
+ *
+ * \b tThreadContainerGroup
+ *
+ * Drives multiple thread containers in lockstep - e.g. for simulation
+ * and hardware-in-the-loop tests.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tThreadContainerGroup_h__
+#define __plugins__scheduling__tThreadContainerGroup_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tConditionVariable.h"
+#include "rrlib/time/time.h"
+#include "rrlib/util/tNoncopyable.h"
+#include <functional>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Lock-step execution group for thread containers
+/*!
+ * Drives the cycles of multiple thread containers in lockstep.
+ * In each tick, all members that are due execute one cycle. The tick is complete
+ * when all of them have completed their cycle (barrier).
+ *
+ * The tick duration is the greatest common divisor of the members' cycle times.
+ * So members with different cycle times are executed at the respective rate ratios
+ * (e.g. a member with 10 ms cycle time executes five cycles for every cycle of a member with 50 ms).
+ *
+ * Optionally, members are executed in parallel by worker threads
+ * (each member is always executed by the same thread - so execution is deterministic).
+ * Optionally, the group runs in virtual time: application time is set to the time of each tick
+ * (rrlib::time::tTimeMode::CUSTOM_CLOCK) - so ticks are executed as fast as possible.
+ *
+ * Members must not execute on their own (no StartExecution()) - cycles are executed via ExecuteCycle().
+ * Members may only be added while the group is not executing ticks.
+ */
+class tThreadContainerGroup : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param worker_thread_count Number of additional threads that execute members in parallel (zero executes all members in the calling thread)
+   * \param virtual_time Run in virtual time? (sets time mode to rrlib::time::tTimeMode::CUSTOM_CLOCK - previous time mode is restored when group is destroyed)
+   * \param start_time Time of first tick in virtual time (current time if not specified)
+   */
+  tThreadContainerGroup(size_t worker_thread_count = 0, bool virtual_time = false, const rrlib::time::tTimestamp& start_time = rrlib::time::cNO_TIME);
+
+  ~tThreadContainerGroup();
+
+  /*!
+   * Adds thread container to group
+   *
+   * \param thread_container Thread container (tThreadContainerElement) to add
+   */
+  template <typename TThreadContainerElement>
+  void AddMember(TThreadContainerElement& thread_container)
+  {
+    AddMember(thread_container.GetCycleTime(), [&thread_container]()
+    {
+      thread_container.ExecuteCycle();
+    });
+  }
+
+  /*!
+   * Adds member to group
+   *
+   * \param cycle_time Cycle time of member
+   * \param execute_cycle Function that executes one cycle of member
+   */
+  void AddMember(const rrlib::time::tDuration& cycle_time, const std::function<void()>& execute_cycle);
+
+  /*!
+   * Executes one tick: all members that are due execute one cycle.
+   * Returns when all of them have completed their cycle.
+   */
+  void ExecuteTick();
+
+  /*!
+   * \return Number of ticks executed so far
+   */
+  uint64_t GetTickCount() const
+  {
+    return tick_count;
+  }
+
+  /*!
+   * \return Duration of one tick (greatest common divisor of the members' cycle times)
+   */
+  rrlib::time::tDuration GetTickDuration() const
+  {
+    return tick_duration;
+  }
+
+  /*!
+   * \return Time of next tick (in virtual time mode, this is the application time set during next tick)
+   */
+  rrlib::time::tTimestamp GetTime() const
+  {
+    return time;
+  }
+
+  /*!
+   * Executes ticks for the specified duration (as fast as possible in virtual time mode - otherwise in real-time)
+   *
+   * \param duration Duration to execute (rounded up to a multiple of tick duration)
+   */
+  void Run(const rrlib::time::tDuration& duration);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  class tWorkerThread;
+
+  /*! Member of group */
+  struct tMember
+  {
+    /*! Cycle time of member */
+    rrlib::time::tDuration cycle_time;
+
+    /*! Function that executes one cycle of member */
+    std::function<void()> execute_cycle;
+
+    /*! Member executes one cycle every 'tick_divisor' ticks */
+    uint64_t tick_divisor;
+  };
+
+  /*! Members of group */
+  std::vector<tMember> members;
+
+  /*! Duration of one tick */
+  rrlib::time::tDuration tick_duration;
+
+  /*! Number of ticks executed so far */
+  uint64_t tick_count;
+
+  /*! Run in virtual time? */
+  bool virtual_time;
+
+  /*! Time mode before group switched to virtual time (restored in destructor) */
+  rrlib::time::tTimeMode previous_time_mode;
+
+  /*! Time of next tick */
+  rrlib::time::tTimestamp time;
+
+  /*! Worker threads executing members in parallel */
+  std::vector<std::shared_ptr<tWorkerThread>> worker_threads;
+
+  /*! Mutex for synchronization with worker threads */
+  rrlib::thread::tMutex mutex;
+
+  /*! Signals worker threads that a tick was started - and calling thread that all worker threads completed it */
+  rrlib::thread::tConditionVariable tick_signal;
+
+  /*! Number of ticks started (only accessed with mutex locked - worker threads start a tick when this value changes) */
+  uint64_t started_tick_count;
+
+  /*! Number of worker threads that have completed the current tick */
+  size_t completed_worker_count;
+
+  /*!
+   * Executes cycles of all members due in current tick that are assigned to specified thread
+   *
+   * \param thread_index Index of executing thread (0 is calling thread, workers start at 1)
+   */
+  void ExecuteMembers(size_t thread_index);
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -34,13 +34,19 @@
 //----------------------------------------------------------------------
 #include "core/tRuntimeEnvironment.h"
 #include "core/port/tAggregatedEdge.h"
-#include <set>
+#include <algorithm>
+#include <sys/resource.h>
+#include <time.h>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/scheduling/tExecutionControl.h"
+#include "plugins/scheduling/tFlightRecorder.h"
 #include "plugins/scheduling/tPeriodicFrameworkElementTask.h"
+#include "plugins/scheduling/tProfilePublisherThread.h"
+#include "plugins/scheduling/tRuntimeChangeDispatcher.h"
+#include "plugins/scheduling/tracepoints.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -63,7 +69,7 @@ namespace scheduling
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
 
-/*! Flags used for storing information in tPeriodicFrameworkElementTask::task_classification */
+/*! Flags used for storing information in tScheduleGraph::classification */
 enum tTaskClassificationFlag
 {
   eSENSE_TASK = 1,
@@ -76,16 +82,81 @@ enum tTaskClassificationFlag
 
 typedef core::tFrameworkElement::tFlag tFlag;
 
+/*! Sets of tasks that are scheduled (in this order) */
+enum tTaskSetIndex
+{
+  eINITIAL_TASKS,
+  eSENSE_TASKS,
+  eCONTROL_TASKS,
+  eOTHER_TASKS
+};
+
 //----------------------------------------------------------------------
 // Const values
 //----------------------------------------------------------------------
 #define FINROC_PORT_BASED_SCHEDULING
 
+/*! Lower bound for margin that thread busy-waits for in precise wait mode */
+static const rrlib::time::tDuration cMINIMUM_WAKE_UP_MARGIN = std::chrono::microseconds(10);
+
+/*! Peak of wake-up latency used to tune margin decays by 1/x of its value in each cycle */
+static const int cWAKE_UP_LATENCY_PEAK_DECAY = 1024;
+
+/*! When waiting for release time of a task (time-triggered mode) or for start time, thread sleeps until this duration before - and busy-waits for the rest */
+static const rrlib::time::tDuration cWAIT_SPIN_DURATION = std::chrono::microseconds(50);
+
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
 
-tThreadContainerThread* tThreadContainerThread::single_thread_container = nullptr;
+/*!
+ * Companion thread executing non-critical tasks in mixed-criticality mode (see tThreadContainerThread::EnableMixedCriticality())
+ */
+class tThreadContainerThread::tNonCriticalTaskThread : public rrlib::thread::tThread
+{
+public:
+
+  tNonCriticalTaskThread(tThreadContainerThread& thread) :
+    thread(thread)
+  {
+    this->SetName(thread.GetName() + " (Non-Critical Tasks)");
+  }
+
+  virtual void Run() override
+  {
+    while (true)
+    {
+      {
+        rrlib::thread::tLock lock(thread.non_critical_task_mutex);
+        while ((!thread.non_critical_tasks_executing) && (!IsStopSignalSet()))
+        {
+          thread.non_critical_task_signal.Wait(lock);
+        }
+        if (IsStopSignalSet())
+        {
+          return;
+        }
+      }
+
+      thread.ExecuteNonCriticalTasks();
+
+      rrlib::thread::tLock lock(thread.non_critical_task_mutex);
+      thread.non_critical_tasks_executing = false;
+      thread.non_critical_task_signal.NotifyAll(lock);
+    }
+  }
+
+  virtual void StopThreadImplementation() override
+  {
+    rrlib::thread::tLock lock(thread.non_critical_task_mutex);
+    thread.non_critical_task_signal.NotifyAll(lock);
+  }
+
+private:
+
+  /*! Thread container thread that this is the companion of */
+  tThreadContainerThread& thread;
+};
 
 // Abort predicates for tThreadContainerThread::ForEachConnectedTask()
 static bool IsSensorInterface(core::tEdgeAggregator& ea)
@@ -114,18 +185,93 @@ static inline bool IsInterface(core::tFrameworkElement& fe)
   return fe.GetFlag(tFlag::EDGE_AGGREGATOR) || fe.GetFlag(tFlag::INTERFACE);
 }
 
+/*!
+ * Resource usage counters of calling thread (see SetResourceUsageProfilingEnabled())
+ */
+struct tResourceUsageSample
+{
+  int64_t cpu_time, voluntary_context_switches, involuntary_context_switches, minor_page_faults, major_page_faults;
+
+  /*! Samples current values */
+  void Sample()
+  {
+    timespec cpu_time_spec;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time_spec);
+    cpu_time = static_cast<int64_t>(cpu_time_spec.tv_sec) * 1000000000 + cpu_time_spec.tv_nsec;
+#ifdef RUSAGE_THREAD
+    rusage usage;
+    getrusage(RUSAGE_THREAD, &usage);
+    voluntary_context_switches = usage.ru_nvcsw;
+    involuntary_context_switches = usage.ru_nivcsw;
+    minor_page_faults = usage.ru_minflt;
+    major_page_faults = usage.ru_majflt;
+#else
+    voluntary_context_switches = involuntary_context_switches = minor_page_faults = major_page_faults = 0;
+#endif
+  }
+};
 
 tThreadContainerThread::tThreadContainerThread(core::tFrameworkElement& thread_container, rrlib::time::tDuration default_cycle_time,
     bool warn_on_cycle_time_exceed, data_ports::tOutputPort<rrlib::time::tDuration> execution_duration,
-    data_ports::tOutputPort<std::vector<tTaskProfile>> execution_details) :
+    data_ports::tOutputPort<std::vector<tTaskProfile>> execution_details, data_ports::tOutputPort<rrlib::serialization::tMemoryBuffer> execution_details_compact) :
   tLoopThread(default_cycle_time, true, warn_on_cycle_time_exceed),
   tWatchDogTask(true),
   thread_container(thread_container),
   reschedule(true),
+  pause_requested(false),
+  executing_cycle(false),
+  manual_cycle(false),
+  start_time(rrlib::time::cNO_TIME),
   schedule(),
+  schedule_version(0),
   task_set_first_index { 0, 0, 0, 0 },
+  schedule_graph(),
+  execution_plan(),
+  task_statistics(),
                      execution_duration(execution_duration),
                      execution_details(execution_details),
+                     profile_publisher(),
+                     task_duration_ports(),
+                     telemetry_slot(nullptr),
+                     flight_recorder(),
+                     performance_counters(),
+                     locality_aware_ordering(false),
+                     utilization_window(),
+                     utilization_port(),
+                     utilization(),
+                     reschedule_count(0),
+                     reschedule_count_port(),
+                     background_jobs(),
+                     background_job_mutex(),
+                     next_background_job(0),
+                     background_job_safety_margin(std::chrono::microseconds(500)),
+                     non_critical_task_thread(),
+                     non_critical_task_mutex(),
+                     non_critical_task_signal(non_critical_task_mutex),
+                     non_critical_tasks_executing(false),
+                     non_critical_cycle_start(rrlib::time::cNO_TIME),
+                     non_critical_overrun_count(0),
+                     non_critical_task_durations(),
+                     non_critical_task_durations_pending(false),
+                     non_critical_execution_duration(),
+                     non_critical_overruns(),
+                     statistics_snapshots(false),
+                     statistics_snapshot_storages(),
+                     statistics_snapshot_storage(nullptr),
+                     statistics_snapshot_lock(),
+                     time_triggered(false),
+                     time_triggered_calibration_cycles(0),
+                     time_triggered_budget_margin(0),
+                     time_triggered_calibrated_cycle_count(0),
+                     release_table(),
+                     release_offset_violation_count(0),
+                     release_offset_violations(),
+                     precise_wait(false),
+                     minimum_wake_up_margin(0),
+                     wake_up_margin(0),
+                     wake_up_latency_peak(0),
+                     last_spin_duration(0),
+                     spin_duration(),
                      total_execution_duration(0),
                      max_execution_duration(0),
                      execution_count(0),
@@ -133,31 +279,81 @@ tThreadContainerThread::tThreadContainerThread(core::tFrameworkElement& thread_c
                      current_cycle_start_application_time(rrlib::time::cNO_TIME)
 {
   this->SetName("ThreadContainer " + thread_container.GetName());
-  this->thread_container.GetRuntime().AddListener(*this);
+  tRuntimeChangeDispatcher::GetInstance().Add(*this);
+  if (execution_details.GetWrapped())
+  {
+    tProfilePublisherThread* publisher = new tProfilePublisherThread(this->GetName(), default_cycle_time, execution_duration, execution_details, execution_details_compact);
+    publisher->SetAutoDelete();
+    profile_publisher = std::static_pointer_cast<tProfilePublisherThread>(publisher->GetSharedPtr());
+
+    if (IsSharedMemoryTelemetryEnabled())
+    {
+      tTelemetrySegment* segment = tTelemetrySegment::GetProcessSegment();
+      telemetry_slot = segment ? segment->AcquireSlot() : nullptr;
+      if (!telemetry_slot)
+      {
+        FINROC_LOG_PRINT(WARNING, "Could not obtain slot in shared memory telemetry segment. Telemetry for this thread container is disabled.");
+      }
+    }
+  }
 #ifdef RRLIB_SINGLE_THREADED
-  assert(single_thread_container == nullptr);
-  single_thread_container = this;
+  tSingleThreadedExecutor::GetInstance().Add(*this);
 #endif
 }
 
 tThreadContainerThread::~tThreadContainerThread()
 {
-  this->thread_container.GetRuntime().RemoveListener(*this);
-  single_thread_container = nullptr;
+  tRuntimeChangeDispatcher::GetInstance().Remove(*this);
+  if (telemetry_slot)
+  {
+    tTelemetrySegment::GetProcessSegment()->ReleaseSlot(*telemetry_slot);
+  }
+  {
+    // release tasks that were migrated away before this thread executed another cycle
+    rrlib::thread::tLock lock(tPeriodicFrameworkElementTask::GetMigratedTasksMutex());
+    for (tPeriodicFrameworkElementTask * task : tPeriodicFrameworkElementTask::GetMigratedTasks())
+    {
+      if (task->owner.load(std::memory_order_relaxed) == &thread_container && task->assigned_thread_container != &thread_container)
+      {
+        task->Release(rrlib::time::Now());
+      }
+    }
+  }
+#ifdef RRLIB_SINGLE_THREADED
+  tSingleThreadedExecutor::GetInstance().Remove(*this);
+#endif
+}
+
+void tThreadContainerThread::ComputeReleaseTable()
+{
+  // Only critical tasks are released by this thread - non-critical tasks run in companion thread (mixed-criticality mode)
+  release_table.Compute(task_statistics.max_execution_duration, GetCriticalTaskCount(), time_triggered_budget_margin);
+  rrlib::time::tDuration offset = release_table.GetTotalBudget();
+  FINROC_LOG_PRINT(DEBUG, "Computed time-triggered release table for ", release_table.GetSize(), " tasks (total budget: ", rrlib::time::ToIsoString(offset), ")");
+  if (offset > GetCycleTime())
+  {
+    FINROC_LOG_PRINT(WARNING, "Total budget of time-triggered release table (", rrlib::time::ToIsoString(offset), ") exceeds cycle time (", rrlib::time::ToIsoString(GetCycleTime()), ")");
+  }
+}
+
+size_t tThreadContainerThread::GetCriticalTaskCount() const
+{
+  return non_critical_task_thread ? std::min(task_set_first_index[eOTHER_TASKS], execution_plan.size()) : execution_plan.size();
 }
 
-std::string tThreadContainerThread::CreateLoopDebugOutput(const std::vector<tPeriodicFrameworkElementTask*>& task_list)
+std::string tThreadContainerThread::CreateLoopDebugOutput(const std::vector<uint32_t>& task_list)
 {
+  const tScheduleGraph& graph = schedule_graph;
   std::ostringstream stream;
   for (auto it = task_list.rbegin(); it != task_list.rend(); ++it)
   {
     stream << (it != task_list.rbegin() ? "-> " : "   ");
-    stream << (*it)->GetLogDescription() << std::endl;
-    for (auto next = (*it)->next_tasks.begin(); next != (*it)->next_tasks.end(); ++next)
+    stream << graph.tasks[*it]->GetLogDescription() << std::endl;
+    for (uint32_t i = graph.successor_offsets[*it]; i < graph.successor_offsets[*it + 1]; i++)
     {
-      if (*next == *task_list.rbegin())
+      if (graph.successors[i] == *task_list.rbegin())
       {
-        stream << "-> " << (*next)->GetLogDescription();
+        stream << "-> " << graph.tasks[graph.successors[i]]->GetLogDescription();
         return stream.str();
       }
     }
@@ -213,8 +409,7 @@ void tThreadContainerThread::ForEachConnectedTask(core::tAbstractPort& origin, s
     core::tAggregatedEdge& aggregated_edge = trace_reverse ? **it_incoming : **it_outgoing;
     core::tEdgeAggregator* dest_aggregator = trace_reverse ? &aggregated_edge.source : &aggregated_edge.destination;
 #endif
-    tExecutionControl* execution_control = dest_aggregator ? tExecutionControl::Find(*dest_aggregator) : nullptr;
-    if ((!execution_control) || execution_control->GetAnnotated<core::tFrameworkElement>() != &thread_container)
+    if ((!dest_aggregator) || (!IsScheduledHere(*dest_aggregator)))
     {
       continue;
     }
@@ -266,7 +461,7 @@ void tThreadContainerThread::ForEachConnectedTask(core::tAbstractPort& origin, s
         ForEachConnectedTask<ABORT_PREDICATE, TFunction>(dest, trace, function, trace_reverse);
 #endif
       }
-      else if (IsModuleInputInterface(dest)) // in case we have a module with event-triggered execution (and, hence, no periodic task)
+      else if (IsModuleInputInterface(dest)) // in case we have a module with event-triggered execution in port callbacks (and, hence, no task)
       {
         core::tFrameworkElement* parent = dest.GetParent();
         if (parent->GetFlag(tFlag::EDGE_AGGREGATOR))
@@ -302,8 +497,185 @@ void tThreadContainerThread::ForEachConnectedTask(core::tAbstractPort& origin, s
 #endif
 }
 
+void tThreadContainerThread::AddBackgroundJob(tBackgroundJob& job)
+{
+  rrlib::thread::tLock lock(background_job_mutex);
+  if (std::find(background_jobs.begin(), background_jobs.end(), &job) == background_jobs.end())
+  {
+    background_jobs.push_back(&job);
+  }
+}
+
+void tThreadContainerThread::EnableFlightRecorder(size_t cycle_count, double overrun_threshold, const std::string& dump_directory)
+{
+  assert(!flight_recorder);
+  tFlightRecorder* recorder = new tFlightRecorder(thread_container.GetName(), cycle_count, overrun_threshold, dump_directory);
+  recorder->SetAutoDelete();
+  flight_recorder = std::static_pointer_cast<tFlightRecorder>(recorder->GetSharedPtr());
+}
+
+void tThreadContainerThread::EnableUtilizationMonitoring(size_t window_size, data_ports::tOutputPort<tUtilization> utilization)
+{
+  utilization_window.reset(new tUtilizationWindow(window_size));
+  utilization_port = utilization;
+  if (profile_publisher)
+  {
+    profile_publisher->SetUtilizationPort(utilization);
+  }
+}
+
+void tThreadContainerThread::ExecuteBackgroundJobs()
+{
+  rrlib::thread::tLock lock(background_job_mutex);
+  rrlib::time::tTimestamp deadline = tLoopThread::GetCurrentCycleStartTime() + GetCycleTime() - background_job_safety_margin;
+  while ((!background_jobs.empty()) && rrlib::time::Now(true) < deadline && (!pause_requested) && (!IsStopSignalSet()))
+  {
+    if (next_background_job >= background_jobs.size())
+    {
+      next_background_job = 0;
+    }
+    tBackgroundJob* job = background_jobs[next_background_job];
+    if (job->ExecuteSlice(deadline))
+    {
+      next_background_job++;
+    }
+    else
+    {
+      background_jobs.erase(background_jobs.begin() + next_background_job);
+    }
+  }
+}
+
+void tThreadContainerThread::EnableMixedCriticality(data_ports::tOutputPort<rrlib::time::tDuration> non_critical_execution_duration,
+    data_ports::tOutputPort<unsigned int> non_critical_overruns)
+{
+  this->non_critical_execution_duration = non_critical_execution_duration;
+  this->non_critical_overruns = non_critical_overruns;
+  tNonCriticalTaskThread* companion = new tNonCriticalTaskThread(*this);
+  companion->SetAutoDelete();
+  non_critical_task_thread = std::static_pointer_cast<tNonCriticalTaskThread>(companion->GetSharedPtr());
+}
+
+void tThreadContainerThread::EnableTimeTriggeredMode(size_t calibration_cycles, double budget_margin, data_ports::tOutputPort<unsigned int> release_offset_violations)
+{
+  time_triggered = true;
+  time_triggered_calibration_cycles = std::max<size_t>(1, calibration_cycles);
+  time_triggered_budget_margin = std::max(0.0, budget_margin);
+  this->release_offset_violations = release_offset_violations;
+}
+
+void tThreadContainerThread::ExecuteNonCriticalTasks()
+{
+  rrlib::time::tTimestamp start = rrlib::time::Now(true);
+  size_t first_index = task_set_first_index[eOTHER_TASKS];
+  for (size_t i = first_index; i < execution_plan.size(); i++)
+  {
+    tScheduledTask& scheduled_task = execution_plan[i];
+    tPeriodicFrameworkElementTask* task = scheduled_task.task_annotation;
+    non_critical_task_durations[i - first_index] = rrlib::time::tDuration(-1);
+    if ((!scheduled_task.owned) && (!(scheduled_task.owned = task->Claim(thread_container, non_critical_cycle_start))))
+    {
+      continue;
+    }
+    if (scheduled_task.event_triggered && (!task->ConsumeTrigger()))
+    {
+      continue;
+    }
+    FINROC_SCHEDULING_TRACEPOINT3(task_start, thread_container.GetHandle(), scheduled_task.handle, i);
+    rrlib::time::tTimestamp task_start = rrlib::time::Now(true);
+    scheduled_task.task->ExecuteTask();
+    rrlib::time::tDuration task_duration = rrlib::time::Now(true) - task_start;
+    FINROC_SCHEDULING_TRACEPOINT3(task_end, thread_container.GetHandle(), scheduled_task.handle, task_duration.count());
+    non_critical_task_durations[i - first_index] = task_duration;
+  }
+  non_critical_execution_duration.Publish(rrlib::time::Now(true) - start);
+  rrlib::thread::tLock lock(non_critical_task_mutex);
+  non_critical_task_durations_pending = true;
+}
+
+bool tThreadContainerThread::CollectNonCriticalTaskDurations(bool update_statistics)
+{
+  {
+    rrlib::thread::tLock lock(non_critical_task_mutex);
+    if (non_critical_tasks_executing || (!non_critical_task_durations_pending))
+    {
+      return false;
+    }
+    non_critical_task_durations_pending = false;
+  }
+
+  // Companion thread does not access durations and statistics before tasks are handed over again
+  size_t first_index = task_set_first_index[eOTHER_TASKS];
+  for (size_t i = first_index; update_statistics && i < execution_plan.size(); i++)
+  {
+    rrlib::time::tDuration task_duration = non_critical_task_durations[i - first_index];
+    if (task_duration >= rrlib::time::tDuration::zero())
+    {
+      task_statistics.last_execution_duration[i] = task_duration;
+      task_statistics.total_execution_duration[i] += task_duration;
+      task_statistics.execution_count[i]++;
+      task_statistics.max_execution_duration[i] = std::max(task_duration, task_statistics.max_execution_duration[i]);
+    }
+  }
+  return true;
+}
+
+void tThreadContainerThread::EnablePreciseWait(rrlib::time::tDuration initial_margin, data_ports::tOutputPort<rrlib::time::tDuration> spin_duration)
+{
+  precise_wait = true;
+  minimum_wake_up_margin = std::max(initial_margin, cMINIMUM_WAKE_UP_MARGIN);
+  wake_up_margin = minimum_wake_up_margin;
+  wake_up_latency_peak = rrlib::time::tDuration::zero();
+  this->spin_duration = spin_duration;
+  if (profile_publisher)
+  {
+    profile_publisher->SetSpinDurationPort(spin_duration);
+  }
+}
+
+void tThreadContainerThread::GetStatisticsSnapshot(tStatisticsSnapshot& snapshot)
+{
+  while (true)
+  {
+    uint32_t sequence = statistics_snapshot_lock.BeginRead();
+    const tStatisticsSnapshotStorage* storage = statistics_snapshot_storage.load(std::memory_order_acquire);
+    size_t size = storage ? storage->size : 0;
+    if (snapshot.profiles.size() != size || snapshot.execution_counts.size() != size)
+    {
+      // Resize snapshot outside of sequence lock (size is only used if it was read consistently)
+      if (statistics_snapshot_lock.ValidateRead(sequence))
+      {
+        snapshot.profiles.resize(size);
+        snapshot.execution_counts.resize(size);
+      }
+      continue;
+    }
+    if (storage)
+    {
+      snapshot.cycle_count = storage->cycle_count;
+      snapshot.schedule_version = storage->schedule_version;
+      std::copy(storage->profiles.begin(), storage->profiles.begin() + size, snapshot.profiles.begin());
+      std::copy(storage->execution_counts.begin(), storage->execution_counts.begin() + size, snapshot.execution_counts.begin());
+    }
+    else
+    {
+      snapshot.cycle_count = 0;
+      snapshot.schedule_version = 0;
+    }
+    if (statistics_snapshot_lock.ValidateRead(sequence))
+    {
+      return;
+    }
+  }
+}
+
 void tThreadContainerThread::HandleWatchdogAlert()
 {
+  FINROC_SCHEDULING_TRACEPOINT2(watchdog_alert, thread_container.GetHandle(), current_task ? static_cast<core::tFrameworkElement::tHandle>(current_task->GetAnnotated<core::tFrameworkElement>()->GetHandle()) : 0);
+  if (flight_recorder)
+  {
+    flight_recorder->TriggerDump("watchdog alert", true);
+  }
   tPeriodicFrameworkElementTask* task = current_task;
   if (!task)
   {
@@ -339,368 +711,1082 @@ bool tThreadContainerThread::IsModuleInputInterface(core::tFrameworkElement& fe)
   return false;
 }
 
-void tThreadContainerThread::MainLoopCallback()
+void tThreadContainerThread::RequestFlightRecorderDump()
 {
-  if (reschedule)
+  if (flight_recorder)
   {
-    // TODO: this rescheduling implementation leads to unpredictable delays (scheduling could be performed by another thread)
-    reschedule = false;
-    {
-      tLock lock(this->thread_container.GetStructureMutex());
-      schedule.clear();
-      rrlib::time::tTimestamp start_time = rrlib::time::Now();
+    flight_recorder->RequestDump();
+  }
+}
+
+void tThreadContainerThread::RequestPause()
+{
+  pause_requested = true;
+  PauseThread();
+}
+
+void tThreadContainerThread::Reschedule()
+{
+  tLock lock(this->thread_container.GetStructureMutex());
+  schedule.clear();
+  schedule_version++;
+  rrlib::time::tTimestamp start_time = rrlib::time::Now();
+  FINROC_SCHEDULING_TRACEPOINT1(reschedule_start, thread_container.GetHandle());
 
-      /*! Sets of tasks that need to be scheduled */
-      std::set<tPeriodicFrameworkElementTask*> sense_tasks, control_tasks, initial_tasks, other_tasks;
+  // Scheduling data is built in schedule_graph (whose arrays keep their memory)
+  tScheduleGraph& graph = schedule_graph;
+  graph.Clear();
+
+  // Index of tasks in previous execution plan (to look up measured durations and carry over statistics)
+  for (size_t i = 0; i < execution_plan.size(); i++)
+  {
+    graph.previous_plan_index.emplace_back(execution_plan[i].handle, i);
+  }
+  std::sort(graph.previous_plan_index.begin(), graph.previous_plan_index.end());
+
+  // find tasks and classified interfaces
+  for (auto it = thread_container.SubElementsBegin(true); it != thread_container.SubElementsEnd(); ++it)
+  {
+    if ((!it->IsReady()) || tExecutionControl::Find(*it)->GetAnnotated<core::tFrameworkElement>() != &thread_container)    // don't handle elements in nested thread containers
+    {
+      continue;
+    }
+    tPeriodicFrameworkElementTask* task = it->GetAnnotation<tPeriodicFrameworkElementTask>();
+    if (task && (!task->assigned_thread_container))  // migrated tasks are added below
+    {
+      graph.tasks.push_back(task);
+    }
 
-      /*! Sense and control interfaces */
-      std::set<core::tEdgeAggregator*> sense_interfaces, control_interfaces;
+    if (it->GetFlag(tFlag::INTERFACE))
+    {
+      if (it->GetFlag(tFlag::SENSOR_DATA))
+      {
+        graph.sense_interfaces.push_back(static_cast<core::tEdgeAggregator*>(&(*it)));
+      }
+      if (it->GetFlag(tFlag::CONTROLLER_DATA))
+      {
+        graph.control_interfaces.push_back(static_cast<core::tEdgeAggregator*>(&(*it)));
+      }
+    }
+  }
 
-      // find tasks and classified interfaces
-      for (auto it = thread_container.SubElementsBegin(true); it != thread_container.SubElementsEnd(); ++it)
+  // add tasks migrated to this thread container - and release tasks migrated away
+  {
+    rrlib::time::tTimestamp release_time = IsExecutingPeriodically() ? tLoopThread::GetCurrentCycleStartTime() : rrlib::time::Now();
+    rrlib::thread::tLock lock2(tPeriodicFrameworkElementTask::GetMigratedTasksMutex());
+    for (tPeriodicFrameworkElementTask * task : tPeriodicFrameworkElementTask::GetMigratedTasks())
+    {
+      if (task->assigned_thread_container == &thread_container)
       {
-        if ((!it->IsReady()) || tExecutionControl::Find(*it)->GetAnnotated<core::tFrameworkElement>() != &thread_container)    // don't handle elements in nested thread containers
+        if (task->GetAnnotated<core::tFrameworkElement>()->IsReady())
         {
-          continue;
+          graph.tasks.push_back(task);
         }
-        tPeriodicFrameworkElementTask* task = it->GetAnnotation<tPeriodicFrameworkElementTask>();
-        if (task)
+      }
+      else if (task->owner.load(std::memory_order_relaxed) == &thread_container)
+      {
+        task->Release(release_time);  // last cycle with this task is complete
+      }
+    }
+  }
+
+  // order tasks by handle (so that schedules are deterministic - and do not depend on memory addresses of tasks)
+  std::sort(graph.tasks.begin(), graph.tasks.end(), [](tPeriodicFrameworkElementTask * task1, tPeriodicFrameworkElementTask * task2)
+  {
+    return task1->GetAnnotated<core::tFrameworkElement>()->GetHandle() < task2->GetAnnotated<core::tFrameworkElement>()->GetHandle();
+  });
+  const size_t task_count = graph.tasks.size();
+  graph.classification.assign(task_count, 0);
+  graph.task_sets.assign(task_count, 0);
+  for (size_t i = 0; i < task_count; i++)
+  {
+    tPeriodicFrameworkElementTask* task = graph.tasks[i];
+    task->schedule_graph_index = i;
+    if (task->IsSenseTask())
+    {
+      graph.classification[i] = eSENSE_TASK;
+      graph.task_sets[i] = 1 << eSENSE_TASKS;
+      graph.sense_interfaces.insert(graph.sense_interfaces.end(), task->incoming.begin(), task->incoming.end());
+      graph.sense_interfaces.insert(graph.sense_interfaces.end(), task->outgoing.begin(), task->outgoing.end());
+    }
+    else if (task->IsControlTask())
+    {
+      graph.classification[i] = eCONTROL_TASK;
+      graph.task_sets[i] = 1 << eCONTROL_TASKS;
+      graph.control_interfaces.insert(graph.control_interfaces.end(), task->incoming.begin(), task->incoming.end());
+      graph.control_interfaces.insert(graph.control_interfaces.end(), task->outgoing.begin(), task->outgoing.end());
+    }
+    else
+    {
+      graph.task_sets[i] = 1 << eOTHER_TASKS;
+    }
+  }
+  for (std::vector<core::tEdgeAggregator*>* interfaces : { &graph.sense_interfaces, &graph.control_interfaces })
+  {
+    std::sort(interfaces->begin(), interfaces->end());
+    interfaces->erase(std::unique(interfaces->begin(), interfaces->end()), interfaces->end());
+  }
+
+  // classify tasks by flooding
+  std::vector<core::tEdgeAggregator*> trace; // trace we're currently following
+  {
+    struct tFlooding
+    {
+      tThreadContainerThread& thread;
+      tScheduleGraph& graph;
+      std::vector<core::tEdgeAggregator*>& trace;
+      int flag_to_check;
+
+      void operator()(tPeriodicFrameworkElementTask& connected_task)
+      {
+        int64_t index = graph.IndexOf(connected_task);
+        if (index >= 0 && (graph.classification[index] & (flag_to_check | eSENSE_TASK | eCONTROL_TASK)) == 0)
         {
-          task->previous_tasks.clear();
-          task->next_tasks.clear();
-          task->task_classification = 0;
-          if (task->IsSenseTask())
-          {
-            task->task_classification = eSENSE_TASK;
-            sense_tasks.insert(task);
-            sense_interfaces.insert(task->incoming.begin(), task->incoming.end());
-            sense_interfaces.insert(task->outgoing.begin(), task->outgoing.end());
-          }
-          else if (task->IsControlTask())
+          graph.classification[index] |= flag_to_check;
+          bool reverse = (flag_to_check == eSENSE_DEPENDENCY || flag_to_check == eCONTROL_DEPENDENCY);
+          for (core::tEdgeAggregator * next : (reverse ? connected_task.incoming : connected_task.outgoing))
           {
-            task->task_classification = eCONTROL_TASK;
-            control_tasks.insert(task);
-            control_interfaces.insert(task->incoming.begin(), task->incoming.end());
-            control_interfaces.insert(task->outgoing.begin(), task->outgoing.end());
-          }
-          else
-          {
-            other_tasks.insert(task);
+            thread.ForEachConnectedTask<IsSensorOrControllerInterface>(*next, trace, *this, reverse);
           }
         }
+      }
+    } flooding = { *this, graph, trace, 0 };
+
+    for (core::tEdgeAggregator * interface : graph.sense_interfaces)
+    {
+      flooding.flag_to_check = eSENSE_DEPENDENT;
+      ForEachConnectedTask<IsSensorOrControllerInterface>(*interface, trace, flooding, false);
+      flooding.flag_to_check = eSENSE_DEPENDENCY;
+      ForEachConnectedTask<IsSensorOrControllerInterface>(*interface, trace, flooding, true);
+    }
+    for (core::tEdgeAggregator * interface : graph.control_interfaces)
+    {
+      flooding.flag_to_check = eCONTROL_DEPENDENT;
+      ForEachConnectedTask<IsSensorOrControllerInterface>(*interface, trace, flooding, false);
+      flooding.flag_to_check = eCONTROL_DEPENDENCY;
+      ForEachConnectedTask<IsSensorOrControllerInterface>(*interface, trace, flooding, true);
+    }
+  }
+
+  for (size_t task = 0; task < task_count; task++)
+  {
+    if (graph.task_sets[task] != (1 << eOTHER_TASKS))
+    {
+      continue;
+    }
+    int classification = graph.classification[task];
+    bool sense_task = (classification & (eSENSE_DEPENDENCY | eSENSE_DEPENDENT)) == (eSENSE_DEPENDENCY | eSENSE_DEPENDENT);
+    bool control_task = (classification & (eCONTROL_DEPENDENCY | eCONTROL_DEPENDENT)) == (eCONTROL_DEPENDENCY | eCONTROL_DEPENDENT);
+    if (!(sense_task || control_task))
+    {
+      // max. two flags are possible - check all combinations
+      if ((classification & (eSENSE_DEPENDENCY | eCONTROL_DEPENDENCY)) == (eSENSE_DEPENDENCY | eCONTROL_DEPENDENCY))
+      {
+        graph.task_sets[task] = 1 << eINITIAL_TASKS;
+        continue;
+      }
+      if ((classification & (eSENSE_DEPENDENT | eCONTROL_DEPENDENT)) == (eSENSE_DEPENDENT | eCONTROL_DEPENDENT))
+      {
+        continue;
+      }
+      if ((classification & (eSENSE_DEPENDENCY | eCONTROL_DEPENDENT)) == (eSENSE_DEPENDENCY | eCONTROL_DEPENDENT))
+      {
+        sense_task = true;
+      }
+      if ((classification & (eSENSE_DEPENDENT | eCONTROL_DEPENDENCY)) == (eSENSE_DEPENDENT | eCONTROL_DEPENDENCY))
+      {
+        control_task = true;
+      }
+    }
+    if (!(sense_task || control_task))
+    {
+      // max. one flag is possible
+      sense_task = classification & (eSENSE_DEPENDENCY | eSENSE_DEPENDENT);
+      control_task = classification & (eCONTROL_DEPENDENCY | eCONTROL_DEPENDENT);
+    }
 
-        if (it->GetFlag(tFlag::INTERFACE))
+    if (sense_task || control_task)
+    {
+      graph.task_sets[task] = (sense_task ? (1 << eSENSE_TASKS) : 0) | (control_task ? (1 << eCONTROL_TASKS) : 0);
+    }
+  }
+
+  // Average execution duration of each task measured so far (unmeasured tasks count one nanosecond, so that the number of tasks is relevant)
+  auto measured_duration = [&](uint32_t task)
+  {
+    int64_t previous = graph.PreviousPlanIndexOf(graph.tasks[task]->GetAnnotated<core::tFrameworkElement>()->GetHandle());
+    if (previous >= 0 && task_statistics.execution_count[previous] > 0)
+    {
+      return std::max<int64_t>(1, task_statistics.total_execution_duration[previous].count() / task_statistics.execution_count[previous]);
+    }
+    return static_cast<int64_t>(1);
+  };
+
+  // create task graphs for the four relevant sets of tasks and schedule them
+  for (size_t i = 0; i < 4; i++)
+  {
+    trace.clear();
+    graph.edges.clear();
+    graph.set_members.clear();
+    for (uint32_t task = 0; task < task_count; task++)
+    {
+      if (graph.task_sets[task] & (1 << i))
+      {
+        graph.set_members.push_back(task);
+      }
+    }
+
+    // create task graph: trace outgoing connections to other elements in task set
+    struct tEdgeCollector
+    {
+      tScheduleGraph& graph;
+      uint8_t task_set;
+      uint32_t source;
+      size_t first_edge_of_source;
+
+      void operator()(tPeriodicFrameworkElementTask& connected_task)
+      {
+        int64_t index = graph.IndexOf(connected_task);
+        if (index >= 0 && (graph.task_sets[index] & task_set) &&
+            std::find(graph.edges.begin() + first_edge_of_source, graph.edges.end(), std::pair<uint32_t, uint32_t>(source, index)) == graph.edges.end())
         {
-          if (it->GetFlag(tFlag::SENSOR_DATA))
-          {
-            sense_interfaces.insert(static_cast<core::tEdgeAggregator*>(&(*it)));
-          }
-          if (it->GetFlag(tFlag::CONTROLLER_DATA))
-          {
-            control_interfaces.insert(static_cast<core::tEdgeAggregator*>(&(*it)));
-          }
+          graph.edges.emplace_back(source, index);
         }
       }
-
-      // classify tasks by flooding
-      std::vector<core::tEdgeAggregator*> trace; // trace we're currently following
+    } edge_collector = { graph, static_cast<uint8_t>(1 << i), 0, 0 };
+    for (uint32_t task : graph.set_members)
+    {
+      edge_collector.source = task;
+      edge_collector.first_edge_of_source = graph.edges.size();
+      for (core::tEdgeAggregator * outgoing : graph.tasks[task]->outgoing)
       {
-        int flag_to_check = 0;
-        std::function<void (tPeriodicFrameworkElementTask&)> function = [&](tPeriodicFrameworkElementTask & connected_task)
+        if (i == eSENSE_TASKS)
         {
-          if ((connected_task.task_classification & (flag_to_check | eSENSE_TASK | eCONTROL_TASK)) == 0)
-          {
-            connected_task.task_classification |= flag_to_check;
-            bool reverse = (flag_to_check == eSENSE_DEPENDENCY || flag_to_check == eCONTROL_DEPENDENCY);
-            for (core::tEdgeAggregator * next : (reverse ? connected_task.incoming : connected_task.outgoing))
-            {
-              ForEachConnectedTask<IsSensorOrControllerInterface>(*next, trace, function, reverse);
-            }
-          }
-        };
-
-        for (core::tEdgeAggregator * interface : sense_interfaces)
+          ForEachConnectedTask<IsControllerInterface>(*outgoing, trace, edge_collector, false);
+        }
+        else if (i == eCONTROL_TASKS)
         {
-          flag_to_check = eSENSE_DEPENDENT;
-          ForEachConnectedTask<IsSensorOrControllerInterface>(*interface, trace, function, false);
-          flag_to_check = eSENSE_DEPENDENCY;
-          ForEachConnectedTask<IsSensorOrControllerInterface>(*interface, trace, function, true);
+          ForEachConnectedTask<IsSensorInterface>(*outgoing, trace, edge_collector, false);
         }
-        for (core::tEdgeAggregator * interface : control_interfaces)
+        else
         {
-          flag_to_check = eCONTROL_DEPENDENT;
-          ForEachConnectedTask<IsSensorOrControllerInterface>(*interface, trace, function, false);
-          flag_to_check = eCONTROL_DEPENDENCY;
-          ForEachConnectedTask<IsSensorOrControllerInterface>(*interface, trace, function, true);
+          ForEachConnectedTask<AlwaysFalse>(*outgoing, trace, edge_collector, false);
         }
       }
+    }
+    graph.BuildAdjacency();
 
-      std::set<tPeriodicFrameworkElementTask*> other_tasks_copy = other_tasks;
-      for (tPeriodicFrameworkElementTask * other_task : other_tasks_copy)
+    // Priority of tasks: longest remaining path to the end of the task set (sum of measured average execution durations).
+    // Among tasks that are ready, the one with the highest priority is scheduled first - so that tasks on the
+    // latency-critical path are executed as early as possible (e.g. controller outputs are available sooner).
+    // Computed by iterative depth-first search (edges to tasks on the stack close loops and are ignored).
+    graph.remaining_path.assign(task_count, 0);
+    graph.scheduled.assign(task_count, 0);  // used as DFS state here: 0 unvisited, 1 on stack, 2 done
+    graph.edge_cursor.assign(graph.successor_offsets.begin(), graph.successor_offsets.end() - 1);
+    for (uint32_t root : graph.set_members)
+    {
+      if (graph.scheduled[root])
       {
-        bool sense_task = (other_task->task_classification & (eSENSE_DEPENDENCY | eSENSE_DEPENDENT)) == (eSENSE_DEPENDENCY | eSENSE_DEPENDENT);
-        bool control_task = (other_task->task_classification & (eCONTROL_DEPENDENCY | eCONTROL_DEPENDENT)) == (eCONTROL_DEPENDENCY | eCONTROL_DEPENDENT);
-        if (!(sense_task || control_task))
-        {
-          // max. two flags are possible - check all combinations
-          if ((other_task->task_classification & (eSENSE_DEPENDENCY | eCONTROL_DEPENDENCY)) == (eSENSE_DEPENDENCY | eCONTROL_DEPENDENCY))
-          {
-            initial_tasks.insert(other_task);
-            other_tasks.erase(other_task);
-            continue;
-          }
-          if ((other_task->task_classification & (eSENSE_DEPENDENT | eCONTROL_DEPENDENT)) == (eSENSE_DEPENDENT | eCONTROL_DEPENDENT))
-          {
-            continue;
-          }
-          if ((other_task->task_classification & (eSENSE_DEPENDENCY | eCONTROL_DEPENDENT)) == (eSENSE_DEPENDENCY | eCONTROL_DEPENDENT))
-          {
-            sense_task = true;
-          }
-          if ((other_task->task_classification & (eSENSE_DEPENDENT | eCONTROL_DEPENDENCY)) == (eSENSE_DEPENDENT | eCONTROL_DEPENDENCY))
+        continue;
+      }
+      graph.stack.clear();
+      graph.stack.push_back(root);
+      graph.scheduled[root] = 1;
+      while (!graph.stack.empty())
+      {
+        uint32_t task = graph.stack.back();
+        if (graph.edge_cursor[task] < graph.successor_offsets[task + 1])
+        {
+          uint32_t next = graph.successors[graph.edge_cursor[task]++];
+          if (!graph.scheduled[next])
           {
-            control_task = true;
+            graph.scheduled[next] = 1;
+            graph.stack.push_back(next);
           }
+          continue;
         }
-        if (!(sense_task || control_task))
+        int64_t longest_next = 0;
+        for (uint32_t e = graph.successor_offsets[task]; e < graph.successor_offsets[task + 1]; e++)
         {
-          // max. one flag is possible
-          sense_task = other_task->task_classification & (eSENSE_DEPENDENCY | eSENSE_DEPENDENT);
-          control_task = other_task->task_classification & (eCONTROL_DEPENDENCY | eCONTROL_DEPENDENT);
+          uint32_t next = graph.successors[e];
+          longest_next = std::max(longest_next, graph.scheduled[next] == 2 ? graph.remaining_path[next] : 0);
         }
+        graph.remaining_path[task] = measured_duration(task) + longest_next;
+        graph.scheduled[task] = 2;
+        graph.stack.pop_back();
+      }
+    }
+
+    // Locality-aware ordering: position in schedule of each task's most recently scheduled predecessor (-1 if there is none)
+    graph.last_predecessor_position.assign(task_count, -1);
+    auto is_preferred = [&](uint32_t task, uint32_t other)
+    {
+      if (locality_aware_ordering && graph.last_predecessor_position[task] != graph.last_predecessor_position[other])
+      {
+        return graph.last_predecessor_position[task] > graph.last_predecessor_position[other];
+      }
+      if (graph.remaining_path[task] != graph.remaining_path[other])
+      {
+        return graph.remaining_path[task] > graph.remaining_path[other];
+      }
+      return task < other;
+    };
+    // ready tasks are kept in a binary heap with the preferred task on top
+    // (a task's position of its last predecessor does not change once it is ready - so heap order stays valid)
+    auto heap_order = [&](uint32_t task, uint32_t other)
+    {
+      return is_preferred(other, task);
+    };
 
-        if (sense_task || control_task)
+    task_set_first_index[i] = schedule.size();
+    graph.scheduled.assign(task_count, 0);
+    graph.pending_predecessor_count.resize(task_count);
+    graph.ready_tasks.clear();
+    for (uint32_t task : graph.set_members)
+    {
+      graph.pending_predecessor_count[task] = graph.predecessor_offsets[task + 1] - graph.predecessor_offsets[task];
+      if (graph.pending_predecessor_count[task] == 0)
+      {
+        graph.ready_tasks.push_back(task);
+      }
+    }
+    std::make_heap(graph.ready_tasks.begin(), graph.ready_tasks.end(), heap_order);
+    auto add_to_schedule = [&](uint32_t task)
+    {
+      schedule.push_back(graph.tasks[task]);
+      graph.scheduled[task] = 1;
+      for (uint32_t e = graph.successor_offsets[task]; e < graph.successor_offsets[task + 1]; e++)
+      {
+        uint32_t next = graph.successors[e];
+        graph.last_predecessor_position[next] = schedule.size() - 1;
+        if ((!graph.scheduled[next]) && (--graph.pending_predecessor_count[next]) == 0)
         {
-          other_tasks.erase(other_task);
-          if (sense_task)
-          {
-            sense_tasks.insert(other_task);
-          }
-          if (control_task)
-          {
-            control_tasks.insert(other_task);
-          }
+          graph.ready_tasks.push_back(next);
+          std::push_heap(graph.ready_tasks.begin(), graph.ready_tasks.end(), heap_order);
         }
       }
+    };
 
-      /*! temporary variable for trace backs */
-      std::vector<tPeriodicFrameworkElementTask*> trace_back;
-
-      // create task graphs for the four relevant sets of tasks and schedule them
-      std::set<tPeriodicFrameworkElementTask*>* task_sets[4] = { &initial_tasks, &sense_tasks, &control_tasks, &other_tasks };
-      for (size_t i = 0; i < 4; i++)
+    // now create schedule
+    size_t first_unscheduled = 0;  // index in set_members
+    for (size_t scheduled_count = 0; scheduled_count < graph.set_members.size(); scheduled_count++)
+    {
+      // do we have a task without previous tasks?
+      // (take the one whose predecessor was scheduled most recently if locality-aware ordering is enabled,
+      //  then the one with the longest remaining path - or the first by handle on ties)
+      if (!graph.ready_tasks.empty())
       {
-        trace.clear();
-        std::set<tPeriodicFrameworkElementTask*>& task_set = *task_sets[i];
-        auto task = task_set.begin();
-        std::function<void (tPeriodicFrameworkElementTask&)> function = [&](tPeriodicFrameworkElementTask & connected_task)
-        {
-          if (task_set.find(&connected_task) != task_set.end() &&
-              std::find((*task)->next_tasks.begin(), (*task)->next_tasks.end(), &connected_task) == (*task)->next_tasks.end())
-          {
-            (*task)->next_tasks.push_back(&connected_task);
-            connected_task.previous_tasks.push_back(*task);
-          }
-        };
+        std::pop_heap(graph.ready_tasks.begin(), graph.ready_tasks.end(), heap_order);
+        uint32_t task = graph.ready_tasks.back();
+        graph.ready_tasks.pop_back();
+        add_to_schedule(task);
+        continue;
+      }
 
-        // create task graph
-        for (; task != task_set.end(); ++task)
+      // ok, we didn't find task to continue with... (loop)
+      while (graph.scheduled[graph.set_members[first_unscheduled]])
+      {
+        first_unscheduled++;
+      }
+      graph.trace_back.clear();
+      uint32_t current = graph.set_members[first_unscheduled];
+      graph.trace_back.push_back(current);
+      while (true)
+      {
+        bool end = true;
+        for (uint32_t e = graph.predecessor_offsets[current]; e < graph.predecessor_offsets[current + 1]; e++)
         {
-          // trace outgoing connections to other elements in task set
-          for (auto it = (*task)->outgoing.begin(); it < (*task)->outgoing.end(); ++it)
+          uint32_t prev = graph.predecessors[e];
+          if ((!graph.scheduled[prev]) && std::find(graph.trace_back.begin(), graph.trace_back.end(), prev) == graph.trace_back.end())
           {
-            if (i == 1)
-            {
-              ForEachConnectedTask<IsControllerInterface>(**it, trace, function, false);
-            }
-            else if (i == 2)
-            {
-              ForEachConnectedTask<IsSensorInterface>(**it, trace, function, false);
-            }
-            else
-            {
-              ForEachConnectedTask<AlwaysFalse>(**it, trace, function, false);
-            }
+            end = false;
+            current = prev;
+            graph.trace_back.push_back(current);
+            break;
           }
         }
-
-        task_set_first_index[i] = schedule.size();
-
-        // now create schedule
-        while (task_set.size() > 0)
+        if (end)
         {
-          // do we have a task without previous tasks?
-          bool found = false;
-          for (auto it = task_set.begin(); it != task_set.end(); ++it)
+          uint32_t first_previous = current;
+          for (uint32_t e = graph.predecessor_offsets[current]; e < graph.predecessor_offsets[current + 1]; e++)
           {
-            tPeriodicFrameworkElementTask* task = *it;
-            if (task->previous_tasks.size() == 0)
+            if (!graph.scheduled[graph.predecessors[e]])
             {
-              schedule.push_back(task);
-              task_set.erase(task);
-              found = true;
-
-              // delete from next tasks' previous task list
-              for (auto next = task->next_tasks.begin(); next != task->next_tasks.end(); ++next)
-              {
-                (*next)->previous_tasks.erase(std::remove((*next)->previous_tasks.begin(), (*next)->previous_tasks.end(), task), (*next)->previous_tasks.end());
-              }
-              break;
-            }
-          }
-          if (found)
-          {
-            continue;
-          }
-
-          // ok, we didn't find task to continue with... (loop)
-          trace_back.clear();
-          tPeriodicFrameworkElementTask* current = *task_set.begin();
-          trace_back.push_back(current);
-          while (true)
-          {
-            bool end = true;
-            for (size_t i = 0u; i < current->previous_tasks.size(); i++)
-            {
-              tPeriodicFrameworkElementTask* prev = current->previous_tasks[i];
-              if (std::find(trace_back.begin(), trace_back.end(), prev) == trace_back.end())
-              {
-                end = false;
-                current = prev;
-                trace_back.push_back(current);
-                break;
-              }
-            }
-            if (end)
-            {
-              FINROC_LOG_PRINT(WARNING, "Detected loop:\n", CreateLoopDebugOutput(trace_back), "\nBreaking it up at '", current->previous_tasks[0]->GetLogDescription(), "' -> '", current->GetLogDescription(), "' (The latter will be executed before the former)");
-              schedule.push_back(current);
-              task_set.erase(current);
-
-              // delete from next tasks' previous task list
-              for (auto next = current->next_tasks.begin(); next != current->next_tasks.end(); ++next)
-              {
-                (*next)->previous_tasks.erase(std::remove((*next)->previous_tasks.begin(), (*next)->previous_tasks.end(), current), (*next)->previous_tasks.end());
-              }
+              first_previous = graph.predecessors[e];
               break;
             }
           }
+          FINROC_LOG_PRINT(WARNING, "Detected loop:\n", CreateLoopDebugOutput(graph.trace_back), "\nBreaking it up at '", graph.tasks[first_previous]->GetLogDescription(), "' -> '", graph.tasks[current]->GetLogDescription(), "' (The latter will be executed before the former)");
+          add_to_schedule(current);
+          break;
         }
       }
+    }
+  }
+
+  FINROC_LOG_PRINT(DEBUG_VERBOSE_1, "Created schedule in ", rrlib::time::ToIsoString(rrlib::time::Now() - start_time), " (", graph.tasks.size(), " tasks, ", graph.GetMemoryUsage(), " bytes of scheduling data)");
+  for (size_t i = 0; i < schedule.size(); ++i)
+  {
+    FINROC_LOG_PRINT(DEBUG_VERBOSE_1, "  ", i, ": ", schedule[i]->GetLogDescription());
+  }
+
+  // Compile execution plan
+  tTaskStatistics statistics;
+  statistics.Resize(schedule.size());
+  execution_plan.clear();
+  execution_plan.reserve(schedule.size());
+  for (size_t i = 0; i < schedule.size(); i++)
+  {
+    tPeriodicFrameworkElementTask& task = *schedule[i];
+    tScheduledTask scheduled_task;
+    scheduled_task.task = &task.task;
+    scheduled_task.task_annotation = &task;
+    scheduled_task.handle = task.GetAnnotated<core::tFrameworkElement>()->GetHandle();
+    scheduled_task.classification = i < task_set_first_index[1] || i >= task_set_first_index[3] ? tTaskClassification::OTHER :
+                                    (i < task_set_first_index[2] ? tTaskClassification::SENSE : tTaskClassification::CONTROL);
+    scheduled_task.event_triggered = task.IsEventTriggered();
+    scheduled_task.owned = false;
+    if (scheduled_task.event_triggered)
+    {
+      task.AttachTriggerListener();
+    }
+    execution_plan.push_back(scheduled_task);
+
+    // Carry over statistics of tasks that were already scheduled
+    int64_t previous = graph.PreviousPlanIndexOf(scheduled_task.handle);
+    if (previous >= 0)
+    {
+      statistics.total_execution_duration[i] = task_statistics.total_execution_duration[previous];
+      statistics.max_execution_duration[i] = task_statistics.max_execution_duration[previous];
+      statistics.execution_count[i] = task_statistics.execution_count[previous];
+    }
+  }
+  std::swap(statistics, task_statistics);
+  if (non_critical_task_thread)
+  {
+    // companion thread is not executing while rescheduling (see WaitForNonCriticalTasks())
+    non_critical_task_durations.assign(execution_plan.size() - std::min(task_set_first_index[eOTHER_TASKS], execution_plan.size()), rrlib::time::tDuration(-1));
+    tLock lock2(non_critical_task_mutex);
+    non_critical_task_durations_pending = false;
+  }
 
-      FINROC_LOG_PRINT(DEBUG_VERBOSE_1, "Created schedule in ", rrlib::time::ToIsoString(rrlib::time::Now() - start_time));
-      for (size_t i = 0; i < schedule.size(); ++i)
+  if (statistics_snapshots)
+  {
+    // Readers never lock anything: if current storage is too small, a larger one is allocated (and the old one retained)
+    size_t size = execution_plan.size() + 1;
+    tStatisticsSnapshotStorage* storage = statistics_snapshot_storage.load(std::memory_order_relaxed);
+    if ((!storage) || storage->profiles.size() < size)
+    {
+      tStatisticsSnapshotStorage* previous_storage = storage;
+      statistics_snapshot_storages.emplace_back(new tStatisticsSnapshotStorage(std::max(size, previous_storage ? 2 * previous_storage->profiles.size() : 0)));
+      storage = statistics_snapshot_storages.back().get();
+      if (previous_storage)
       {
-        FINROC_LOG_PRINT(DEBUG_VERBOSE_1, "  ", i, ": ", schedule[i]->GetLogDescription());
+        // thread container statistics are kept when rescheduling
+        storage->profiles[0] = previous_storage->profiles[0];
+        storage->execution_counts[0] = previous_storage->execution_counts[0];
       }
     }
+    statistics_snapshot_lock.BeginWrite();
+    statistics_snapshot_storage.store(storage, std::memory_order_release);  // readers access storage only via this pointer
+    storage->cycle_count = execution_count;
+    storage->schedule_version = schedule_version;
+    storage->size = size;
+    storage->profiles[0].handle = thread_container.GetHandle();
+    storage->profiles[0].task_classification = tTaskClassification::OTHER;
+    for (size_t i = 0; i < execution_plan.size(); i++)
+    {
+      storage->profiles[i + 1] = tTaskProfile();
+      storage->profiles[i + 1].handle = execution_plan[i].handle;
+      storage->profiles[i + 1].task_classification = execution_plan[i].classification;
+      storage->execution_counts[i + 1] = 0;
+    }
+    statistics_snapshot_lock.EndWrite();
+  }
+
+  if (profile_publisher)
+  {
+    // Create new vector, as publisher thread might still be publishing records with the old one
+    task_duration_ports.reset(new tProfilePublisherThread::tTaskDurationPorts());
+    for (tScheduledTask & scheduled_task : execution_plan)
+    {
+      task_duration_ports->push_back(scheduled_task.task_annotation->execution_duration);
+    }
+  }
+
+  if (flight_recorder)
+  {
+    std::vector<std::string> task_names;
+    std::vector<core::tFrameworkElement::tHandle> task_handles;
+    for (tScheduledTask & scheduled_task : execution_plan)
+    {
+      task_names.push_back(scheduled_task.task_annotation->GetLogDescription());
+      task_handles.push_back(scheduled_task.handle);
+    }
+    flight_recorder->SetSchedule(schedule_version, task_names, task_handles);
+  }
+
+  if (telemetry_slot)
+  {
+    // Write names, handles and classifications of scheduled tasks (only change when rescheduling)
+    telemetry_slot->lock.BeginWrite();
+    telemetry_slot->entry_count = std::min<size_t>(execution_plan.size(), tTelemetrySegment::cMAX_TASKS) + 1;
+    telemetry_slot->entries[0] = tTelemetrySegment::tEntry();
+    telemetry_slot->entries[0].handle = thread_container.GetHandle();
+    telemetry_slot->entries[0].task_classification = static_cast<uint32_t>(tTaskClassification::OTHER);
+    tTelemetrySegment::CopyName(telemetry_slot->entries[0].name, thread_container.GetQualifiedName());
+    for (size_t i = 1; i < telemetry_slot->entry_count; i++)
+    {
+      tScheduledTask& scheduled_task = execution_plan[i - 1];
+      tTelemetrySegment::tEntry& entry = telemetry_slot->entries[i];
+      entry = tTelemetrySegment::tEntry();
+      entry.handle = scheduled_task.handle;
+      entry.task_classification = static_cast<uint32_t>(scheduled_task.classification);
+      tTelemetrySegment::CopyName(entry.name, scheduled_task.task_annotation->GetLogDescription());
+    }
+    telemetry_slot->lock.EndWrite();
+  }
+
+  FINROC_SCHEDULING_TRACEPOINT3(reschedule_end, thread_container.GetHandle(), execution_plan.size(), (rrlib::time::Now() - start_time).count());
+}
+
+bool tThreadContainerThread::IsScheduledHere(core::tEdgeAggregator& aggregator)
+{
+  tPeriodicFrameworkElementTask* task = aggregator.GetAnnotation<tPeriodicFrameworkElementTask>();
+  if (task == NULL && IsInterface(aggregator))
+  {
+    task = aggregator.GetParent()->GetAnnotation<tPeriodicFrameworkElementTask>();
+  }
+  if (task && task->assigned_thread_container)
+  {
+    return task->assigned_thread_container == &thread_container;
+  }
+  tExecutionControl* execution_control = tExecutionControl::Find(aggregator);
+  return execution_control && execution_control->GetAnnotated<core::tFrameworkElement>() == &thread_container;
+}
+
+void tThreadContainerThread::MainLoopCallback()
+{
+  executing_cycle = true;
+  if (pause_requested && (!manual_cycle))
+  {
+    // pause was requested just before this cycle started (sequentially consistent flags ensure that WaitUntilPaused() does not miss this cycle)
+    executing_cycle = false;
+    return;
+  }
+
+  // synchronized start of parked thread: wait for start time before first cycle (see SetStartTime())
+  rrlib::time::tTimestamp start_time = this->start_time.exchange(rrlib::time::cNO_TIME);
+  bool delayed_start = start_time != rrlib::time::cNO_TIME && IsExecutingPeriodically() && start_time > rrlib::time::Now(true);
+  if (delayed_start)
+  {
+    WaitUntil(start_time);
+  }
+
+  if (reschedule)  // flag is not set for thread containers deferred by open structure batches (see tRuntimeChangeDispatcher)
+  {
+    // TODO: this rescheduling implementation leads to unpredictable delays (scheduling could be performed by another thread)
+    reschedule = false;
+    WaitForNonCriticalTasks();  // companion thread must not access execution plan while it is rebuilt
+    Reschedule();
+    release_table.Clear();
+    time_triggered_calibrated_cycle_count = 0;
+    reschedule_count++;
+    reschedule_count_port.Publish(reschedule_count);
+  }
+
+  rrlib::time::tTimestamp planned_cycle_start = IsExecutingPeriodically() ? (delayed_start ? start_time : tLoopThread::GetCurrentCycleStartTime()) : rrlib::time::cNO_TIME;
+  if (precise_wait && IsExecutingPeriodically() && (!delayed_start))
+  {
+    planned_cycle_start = WaitForCycleStart();
   }
 
   // execute tasks
   SetDeadLine(rrlib::time::Now() + GetCycleTime() * 4 + std::chrono::seconds(4));
 
-  if (execution_details.GetWrapped() == nullptr || execution_count == 0) // we skip profiling the first/initial execution
+  bool profiling = execution_details.GetWrapped() && execution_count > 0; // we skip profiling the first/initial execution
+  bool measure = profiling || flight_recorder || time_triggered || statistics_snapshots;  // measure execution durations of tasks?
+  bool measure_cycle = measure || utilization_window;  // measure execution duration of cycle? (utilization only requires timestamps around task loop)
+  bool calibrate = time_triggered && release_table.IsEmpty() && execution_count > 0;  // measure durations for release table in time-triggered mode?
+  bool update_statistics = profiling || calibrate || (statistics_snapshots && execution_count > 0);
+  bool release_at_offsets = time_triggered && (!release_table.IsEmpty());
+  unsigned int release_offset_violations_in_cycle = 0;
+  bool sample_resource_usage = profiling && IsResourceUsageProfilingEnabled();
+  bool sample_performance_counters = profiling && performance_counters;
+  tPerformanceCounters::tValues counters_before, counters_after, cycle_counters = { 0, 0, 0, 0 };
+  tResourceUsageSample usage_before, usage_after, cycle_usage = { 0, 0, 0, 0, 0 };
+  rrlib::time::tTimestamp start = measure_cycle ? rrlib::time::Now(true) : rrlib::time::cNO_TIME;
+  tProfilePublisherThread::tCycleRecord* record = nullptr;
+  if (profiling)
   {
-    current_cycle_start_application_time = IsUsingApplicationTime() && this->IsAlive() ? tLoopThread::GetCurrentCycleStartTime() : rrlib::time::Now();
+    current_cycle_start_application_time = start;
 
-    execution_duration.Publish(GetLastCycleTime());
-    for (size_t i = 0u; i < schedule.size(); i++)
+    // Profiling information is only written to (preallocated) record here - and published by publisher thread
+    record = profile_publisher->GetFreeRecord();
+    if (record)
     {
-      current_task = schedule[i];
-      //FINROC_LOG_PRINT(DEBUG_WARNING, "Executing ", current_task->GetLogDescription());
-      current_task->task.ExecuteTask();
+      record->profiles.resize(execution_plan.size() + 1);
+      record->task_duration_ports = task_duration_ports;
+      record->schedule_version = schedule_version;
+      record->spin_duration = last_spin_duration;
     }
-    execution_count++;
   }
   else
   {
-    data_ports::tPortDataPointer<std::vector<tTaskProfile>> details = execution_details.GetUnusedBuffer();
-    details->resize(schedule.size() + 1);
-    rrlib::time::tTimestamp start = rrlib::time::Now(true);
-    current_cycle_start_application_time = start;
+    current_cycle_start_application_time = IsUsingApplicationTime() && IsExecutingPeriodically() ? planned_cycle_start : rrlib::time::Now();
+    execution_duration.Publish(GetLastCycleTime());
+    if (precise_wait && spin_duration.GetWrapped())
+    {
+      spin_duration.Publish(last_spin_duration);
+    }
+  }
+  rrlib::time::tTimestamp claim_time = IsExecutingPeriodically() ? planned_cycle_start : rrlib::time::Now();  // for tasks not owned yet
+  bool record_flight = flight_recorder && flight_recorder->BeginCycle(start, IsExecutingPeriodically() ? start - planned_cycle_start : rrlib::time::tDuration::zero(), schedule_version);
 
-    for (size_t i = 0u; i < schedule.size(); i++)
+  FINROC_SCHEDULING_TRACEPOINT2(cycle_start, thread_container.GetHandle(), execution_count);
+  size_t critical_task_count = GetCriticalTaskCount();
+  bool non_critical_durations_collected = critical_task_count < execution_plan.size() && CollectNonCriticalTaskDurations(update_statistics);
+  if (release_at_offsets)
+  {
+    release_table.BeginCycle();
+  }
+  for (size_t i = 0u; i < execution_plan.size(); i++)
+  {
+    tScheduledTask& scheduled_task = execution_plan[i];
+    current_task = scheduled_task.task_annotation;
+    rrlib::time::tDuration task_duration(0);
+    bool task_usage_sampled = false;  // event-triggered tasks that were not executed have zero resource usage and counter values
+    if (i >= critical_task_count)
     {
-      current_task = schedule[i];
+      // non-critical task: executed by companion thread in mixed-criticality mode (duration of its last execution there is reported)
+      if (non_critical_durations_collected && non_critical_task_durations[i - critical_task_count] >= rrlib::time::tDuration::zero())
+      {
+        task_duration = non_critical_task_durations[i - critical_task_count];
+      }
+    }
+    else if ((!scheduled_task.owned) && (!(scheduled_task.owned = current_task->Claim(thread_container, claim_time))))
+    {
+      // task was migrated to this thread container - and has not been released by its previous one yet
+    }
+    else if (scheduled_task.event_triggered && (!current_task->ConsumeTrigger()))
+    {
+      // event-triggered task that was not triggered: not executed
+    }
+    else if (!measure)
+    {
+      //FINROC_LOG_PRINT(DEBUG_WARNING, "Executing ", current_task->GetLogDescription());
+      FINROC_SCHEDULING_TRACEPOINT3(task_start, thread_container.GetHandle(), scheduled_task.handle, i);
+      scheduled_task.task->ExecuteTask();
+      FINROC_SCHEDULING_TRACEPOINT3(task_end, thread_container.GetHandle(), scheduled_task.handle, 0);
+    }
+    else
+    {
+      bool release = release_at_offsets && i < release_table.GetSize();
+      if (release && release_table.GetReleaseTime(i) != rrlib::time::cNO_TIME)
+      {
+        WaitUntil(release_table.GetReleaseTime(i));
+      }
+      if (sample_resource_usage)
+      {
+        usage_before.Sample();
+      }
+      if (sample_performance_counters)
+      {
+        performance_counters->Read(counters_before);
+      }
+      FINROC_SCHEDULING_TRACEPOINT3(task_start, thread_container.GetHandle(), scheduled_task.handle, i);
       rrlib::time::tTimestamp task_start = rrlib::time::Now(true);
-      current_task->task.ExecuteTask();
-      rrlib::time::tDuration task_duration = rrlib::time::Now(true) - task_start;
+      if (release && release_table.RecordTaskStart(i, task_start))
+      {
+        release_offset_violations_in_cycle++;
+      }
+      if (record_flight)
+      {
+        flight_recorder->SetTaskStart(i, task_start - start);
+      }
+      scheduled_task.task->ExecuteTask();
+      task_duration = rrlib::time::Now(true) - task_start;
+      FINROC_SCHEDULING_TRACEPOINT3(task_end, thread_container.GetHandle(), scheduled_task.handle, task_duration.count());
+      if (sample_performance_counters)
+      {
+        performance_counters->Read(counters_after);
+      }
+      if (sample_resource_usage)
+      {
+        usage_after.Sample();
+      }
+      task_usage_sampled = true;
 
-      // Update internal task statistics
-      current_task->total_execution_duration += task_duration;
-      current_task->execution_count++;
-      current_task->max_execution_duration = std::max(task_duration, current_task->max_execution_duration);
+      if (update_statistics)
+      {
+        // Update internal task statistics
+        task_statistics.last_execution_duration[i] = task_duration;
+        task_statistics.total_execution_duration[i] += task_duration;
+        task_statistics.execution_count[i]++;
+        task_statistics.max_execution_duration[i] = std::max(task_duration, task_statistics.max_execution_duration[i]);
+      }
+      if (record_flight)
+      {
+        flight_recorder->SetTaskTiming(i, task_start - start, task_duration);
+      }
+    }
 
-      // Fill task profile to publish
-      tTaskProfile& task_profile = (*details)[i + 1];
-      task_profile.handle = current_task->GetAnnotated<core::tFrameworkElement>()->GetHandle();
+    // Fill task profile to publish (event-triggered tasks that were not executed have a last execution duration of zero)
+    if (record)
+    {
+      tTaskProfile& task_profile = record->profiles[i + 1];  // +1, because first task is at index 1
+      task_profile.handle = scheduled_task.handle;
       task_profile.last_execution_duration = task_duration;
-      task_profile.max_execution_duration = current_task->max_execution_duration;
-      task_profile.average_execution_duration = rrlib::time::tDuration(current_task->total_execution_duration.count() / current_task->execution_count);
-      task_profile.total_execution_duration = current_task->total_execution_duration;
-      task_profile.task_classification = tTaskClassification::OTHER;
+      task_profile.max_execution_duration = task_statistics.max_execution_duration[i];
+      task_profile.average_execution_duration = task_statistics.execution_count[i] ? rrlib::time::tDuration(task_statistics.total_execution_duration[i].count() / task_statistics.execution_count[i]) : rrlib::time::tDuration(0);
+      task_profile.total_execution_duration = task_statistics.total_execution_duration[i];
+      task_profile.task_classification = scheduled_task.classification;
+      if (sample_resource_usage)
+      {
+        task_profile.last_cpu_time = rrlib::time::tDuration(task_usage_sampled ? usage_after.cpu_time - usage_before.cpu_time : 0);
+        task_profile.last_voluntary_context_switches = task_usage_sampled ? usage_after.voluntary_context_switches - usage_before.voluntary_context_switches : 0;
+        task_profile.last_involuntary_context_switches = task_usage_sampled ? usage_after.involuntary_context_switches - usage_before.involuntary_context_switches : 0;
+        task_profile.last_minor_page_faults = task_usage_sampled ? usage_after.minor_page_faults - usage_before.minor_page_faults : 0;
+        task_profile.last_major_page_faults = task_usage_sampled ? usage_after.major_page_faults - usage_before.major_page_faults : 0;
+        cycle_usage.cpu_time += task_profile.last_cpu_time.count();
+        cycle_usage.voluntary_context_switches += task_profile.last_voluntary_context_switches;
+        cycle_usage.involuntary_context_switches += task_profile.last_involuntary_context_switches;
+        cycle_usage.minor_page_faults += task_profile.last_minor_page_faults;
+        cycle_usage.major_page_faults += task_profile.last_major_page_faults;
+      }
+      if (sample_performance_counters)
+      {
+        task_profile.last_cycles = task_usage_sampled ? counters_after.cycles - counters_before.cycles : 0;
+        task_profile.last_instructions = task_usage_sampled ? counters_after.instructions - counters_before.instructions : 0;
+        task_profile.last_cache_misses = task_usage_sampled ? counters_after.cache_misses - counters_before.cache_misses : 0;
+        task_profile.last_branch_misses = task_usage_sampled ? counters_after.branch_misses - counters_before.branch_misses : 0;
+        cycle_counters.cycles += task_profile.last_cycles;
+        cycle_counters.instructions += task_profile.last_instructions;
+        cycle_counters.cache_misses += task_profile.last_cache_misses;
+        cycle_counters.branch_misses += task_profile.last_branch_misses;
+      }
     }
+  }
 
-    // Set classification
-    for (size_t i = task_set_first_index[1]; i < task_set_first_index[2]; i++)
+  if (release_offset_violations_in_cycle)
+  {
+    release_offset_violation_count += release_offset_violations_in_cycle;
+    release_offset_violations.Publish(release_offset_violation_count);
+  }
+
+  // hand non-critical tasks over to companion thread in mixed-criticality mode
+  if (critical_task_count < execution_plan.size())
+  {
+    if (non_critical_task_thread->IsAlive())
     {
-      (*details)[i + 1].task_classification = tTaskClassification::SENSE;  // +1, because first task is at index 1
+      bool overrun = false;
+      {
+        rrlib::thread::tLock lock(non_critical_task_mutex);
+        if (non_critical_tasks_executing)
+        {
+          overrun = true;  // companion thread skips this cycle
+        }
+        else
+        {
+          non_critical_cycle_start = claim_time;
+          non_critical_tasks_executing = true;
+          non_critical_task_signal.NotifyAll(lock);
+        }
+      }
+      if (overrun)
+      {
+        non_critical_overrun_count++;
+        non_critical_overruns.Publish(non_critical_overrun_count);
+      }
     }
-    for (size_t i = task_set_first_index[2]; i < task_set_first_index[3]; i++)
+    else
     {
-      (*details)[i + 1].task_classification = tTaskClassification::CONTROL;
+      non_critical_cycle_start = claim_time;
+      ExecuteNonCriticalTasks();  // cycle is executed manually (or in single-threaded mode)
     }
+  }
 
+  rrlib::time::tDuration duration = measure_cycle ? rrlib::time::Now(true) - start : rrlib::time::tDuration::zero();
+  FINROC_SCHEDULING_TRACEPOINT3(cycle_end, thread_container.GetHandle(), execution_count, duration.count());
+  if (record_flight)
+  {
+    flight_recorder->EndCycle(duration, GetCycleTime());
+    if (!this->IsAlive())
+    {
+      flight_recorder->MainLoopCallback();  // write pending dump directly if cycle is executed manually (and thread was never started)
+    }
+  }
+
+  if (utilization_window && execution_count > 0)
+  {
+    utilization_window->Add(duration, GetCycleTime(), utilization);
+    if (!profiling)
+    {
+      utilization_port.Publish(utilization);
+    }
+    else if (record)
+    {
+      record->utilization = utilization;  // published by publisher thread
+    }
+  }
 
+  if (!profiling)
+  {
+    execution_count++;
+  }
+  else
+  {
     // Update thread statistics
-    rrlib::time::tDuration duration = rrlib::time::Now(true) - start;
     this->total_execution_duration += duration;
     this->execution_count++;
     this->max_execution_duration = std::max(duration, this->max_execution_duration);
 
-    // Fill thread profile to publish
-    tTaskProfile& profile = (*details)[0];
-    profile.handle = thread_container.GetHandle();
-    profile.last_execution_duration = duration;
-    profile.max_execution_duration = this->max_execution_duration;
-    assert(execution_count > 1);
-    profile.average_execution_duration = rrlib::time::tDuration(this->total_execution_duration.count() / (this->execution_count - 1)); // we did not include initial execution for profile statistics
-    profile.total_execution_duration = this->total_execution_duration;
-
-    // Publish profiling information
-    for (size_t i = 0u; i < schedule.size(); i++)
+    if (record)
     {
-      if (schedule[i]->execution_duration.GetWrapped())
+      // Fill thread profile to publish
+      tTaskProfile& profile = record->profiles[0];
+      profile.handle = thread_container.GetHandle();
+      profile.last_execution_duration = duration;
+      profile.max_execution_duration = this->max_execution_duration;
+      assert(execution_count > 1);
+      profile.average_execution_duration = rrlib::time::tDuration(this->total_execution_duration.count() / (this->execution_count - 1)); // we did not include initial execution for profile statistics
+      profile.total_execution_duration = this->total_execution_duration;
+      profile.task_classification = tTaskClassification::OTHER;
+      profile.last_cpu_time = rrlib::time::tDuration(cycle_usage.cpu_time);  // sums of tasks (zero if resource usage profiling is disabled)
+      profile.last_voluntary_context_switches = cycle_usage.voluntary_context_switches;
+      profile.last_involuntary_context_switches = cycle_usage.involuntary_context_switches;
+      profile.last_minor_page_faults = cycle_usage.minor_page_faults;
+      profile.last_major_page_faults = cycle_usage.major_page_faults;
+      profile.last_cycles = cycle_counters.cycles;
+      profile.last_instructions = cycle_counters.instructions;
+      profile.last_cache_misses = cycle_counters.cache_misses;
+      profile.last_branch_misses = cycle_counters.branch_misses;
+
+      if (telemetry_slot)
       {
-        schedule[i]->execution_duration.Publish((*details)[i + 1].last_execution_duration);
+        WriteTelemetry(record->profiles);
+      }
+
+      // Hand record over to publisher thread (or publish it directly if cycle is executed manually - and thread was never started)
+      profile_publisher->Enqueue();
+      if (!this->IsAlive())
+      {
+        profile_publisher->MainLoopCallback();
       }
     }
-    execution_duration.Publish(duration);
-    execution_details.Publish(details);
+  }
+
+  if (statistics_snapshots && statistics_snapshot_storage.load(std::memory_order_relaxed))
+  {
+    UpdateStatisticsSnapshot(duration);
+  }
+
+  if (calibrate)
+  {
+    time_triggered_calibrated_cycle_count++;
+    if (time_triggered_calibrated_cycle_count >= time_triggered_calibration_cycles)
+    {
+      ComputeReleaseTable();
+    }
+  }
+
+  if (IsExecutingPeriodically())
+  {
+    ExecuteBackgroundJobs();
   }
 
   tWatchDogTask::Deactivate();
+  executing_cycle = false;
 }
 
-void tThreadContainerThread::OnEdgeChange(core::tRuntimeListener::tEvent change_type, core::tAbstractPort& source, core::tAbstractPort& target)
+void tThreadContainerThread::WriteTelemetry(const std::vector<tTaskProfile>& profiles)
 {
-  if (source.IsChildOf(this->thread_container) && target.IsChildOf(this->thread_container))
+  telemetry_slot->lock.BeginWrite();
+  telemetry_slot->cycle_count++;
+  size_t entry_count = std::min<size_t>(profiles.size(), telemetry_slot->entry_count);
+  for (size_t i = 0; i < entry_count; i++)
   {
-    reschedule = true;
+    const tTaskProfile& profile = profiles[i];
+    tTelemetrySegment::tEntry& entry = telemetry_slot->entries[i];
+    entry.last_execution_duration = profile.last_execution_duration.count();
+    entry.max_execution_duration = profile.max_execution_duration.count();
+    entry.average_execution_duration = profile.average_execution_duration.count();
+    entry.total_execution_duration = profile.total_execution_duration.count();
   }
+  telemetry_slot->lock.EndWrite();
 }
 
-void tThreadContainerThread::OnFrameworkElementChange(core::tRuntimeListener::tEvent change_type, core::tFrameworkElement& element)
+void tThreadContainerThread::RemoveBackgroundJob(tBackgroundJob& job)
 {
-  if (element.GetAnnotation<tPeriodicFrameworkElementTask>() && element.IsChildOf(this->thread_container, true))
-  {
-    reschedule = true;
-  }
+  rrlib::thread::tLock lock(background_job_mutex);
+  background_jobs.erase(std::remove(background_jobs.begin(), background_jobs.end(), &job), background_jobs.end());
+}
+
+void tThreadContainerThread::Resume()
+{
+  pause_requested = false;
+  ContinueThread();
 }
 
 void tThreadContainerThread::Run()
 {
+  if (profile_publisher)
+  {
+    profile_publisher->Start();
+  }
+  if (flight_recorder)
+  {
+    flight_recorder->Start();
+  }
+  if (non_critical_task_thread)
+  {
+    non_critical_task_thread->Start();
+  }
+  if (profile_publisher && IsPerformanceCounterProfilingEnabled())
+  {
+    // Counters must be opened by this thread, as they count events of the opening thread
+    performance_counters.reset(new tPerformanceCounters());
+    if (!performance_counters->Open())
+    {
+      performance_counters.reset();
+    }
+  }
+
+  // prepared thread (see tThreadContainerElement::PrepareExecution()): wait until released - and for start time, so that loop thread aligns all cycles to it
+  while (pause_requested && (!IsStopSignalSet()))
+  {
+    rrlib::thread::tThread::Sleep(std::chrono::microseconds(100), false);
+  }
+  rrlib::time::tTimestamp start_time = this->start_time.exchange(rrlib::time::cNO_TIME);
+  if (start_time != rrlib::time::cNO_TIME && (!IsStopSignalSet()))
+  {
+    WaitUntil(start_time);
+  }
+
   tLoopThread::Run();
+  performance_counters.reset();
+  if (non_critical_task_thread)
+  {
+    non_critical_task_thread->StopThread();
+    non_critical_task_thread->Join();
+  }
+  if (profile_publisher)
+  {
+    profile_publisher->StopThread();
+    profile_publisher->Join();
+  }
+  if (flight_recorder)
+  {
+    flight_recorder->StopThread();
+    flight_recorder->Join();
+  }
+}
+
+void tThreadContainerThread::UpdateStatisticsSnapshot(rrlib::time::tDuration duration)
+{
+  tStatisticsSnapshotStorage& storage = *statistics_snapshot_storage.load(std::memory_order_relaxed);
+  statistics_snapshot_lock.BeginWrite();
+  storage.cycle_count = execution_count;
+  if (execution_count > 1)  // we do not include initial execution in statistics
+  {
+    tTaskProfile& profile = storage.profiles[0];
+    uint64_t& count = storage.execution_counts[0];
+    count++;
+    profile.last_execution_duration = duration;
+    profile.max_execution_duration = std::max(duration, profile.max_execution_duration);
+    profile.total_execution_duration += duration;
+    profile.average_execution_duration = rrlib::time::tDuration(profile.total_execution_duration.count() / static_cast<int64_t>(count));
+  }
+  size_t task_count = std::min(execution_plan.size(), storage.size - 1);
+  for (size_t i = 0; i < task_count; i++)
+  {
+    tTaskProfile& profile = storage.profiles[i + 1];
+    profile.last_execution_duration = task_statistics.last_execution_duration[i];
+    profile.max_execution_duration = task_statistics.max_execution_duration[i];
+    profile.total_execution_duration = task_statistics.total_execution_duration[i];
+    profile.average_execution_duration = task_statistics.execution_count[i] ? rrlib::time::tDuration(task_statistics.total_execution_duration[i].count() / task_statistics.execution_count[i]) : rrlib::time::tDuration(0);
+    storage.execution_counts[i + 1] = task_statistics.execution_count[i];
+  }
+  statistics_snapshot_lock.EndWrite();
+}
+
+void tThreadContainerThread::WaitForNonCriticalTasks()
+{
+  if (non_critical_task_thread)
+  {
+    rrlib::thread::tLock lock(non_critical_task_mutex);
+    while (non_critical_tasks_executing && non_critical_task_thread->IsAlive())
+    {
+      non_critical_task_signal.Wait(lock, std::chrono::milliseconds(100), false);
+    }
+  }
+}
+
+void tThreadContainerThread::WaitUntil(const rrlib::time::tTimestamp& time)
+{
+  rrlib::time::tTimestamp now = rrlib::time::Now(true);
+  if (now >= time)
+  {
+    return;
+  }
+  if (time - now > cWAIT_SPIN_DURATION)
+  {
+    rrlib::thread::tThread::Sleep(time - now - cWAIT_SPIN_DURATION, true);
+  }
+  while (rrlib::time::Now(true) < time)
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+  }
+}
+
+rrlib::time::tTimestamp tThreadContainerThread::WaitForCycleStart()
+{
+  rrlib::time::tTimestamp wake_up_time = tLoopThread::GetCurrentCycleStartTime();
+  rrlib::time::tTimestamp planned_cycle_start = wake_up_time + wake_up_margin;
+  rrlib::time::tTimestamp now = rrlib::time::Now(true);
+  rrlib::time::tDuration wake_up_latency = now - wake_up_time;
+
+  // Busy-wait on monotonic clock (application time might be adjusted meanwhile)
+  rrlib::time::tDuration remaining = planned_cycle_start - now;
+  if (remaining > rrlib::time::tDuration::zero())
+  {
+    std::chrono::steady_clock::time_point spin_start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point spin_end = spin_start + remaining;
+    std::chrono::steady_clock::time_point spin_now = spin_start;
+    while (spin_now < spin_end)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+      __builtin_ia32_pause();
+#endif
+      spin_now = std::chrono::steady_clock::now();
+    }
+    last_spin_duration = std::chrono::duration_cast<rrlib::time::tDuration>(spin_now - spin_start);
+  }
+  else
+  {
+    last_spin_duration = rrlib::time::tDuration::zero();
+  }
+
+  // Tune margin: decaying peak of wake-up latency plus some headroom
+  // (latencies longer than a cycle are caused by overruns or resuming - not by wake-up jitter)
+  if (wake_up_latency >= rrlib::time::tDuration::zero() && wake_up_latency < GetCycleTime())
+  {
+    wake_up_latency_peak = std::max(wake_up_latency, wake_up_latency_peak - wake_up_latency_peak / cWAKE_UP_LATENCY_PEAK_DECAY);
+    rrlib::time::tDuration margin = wake_up_latency_peak + wake_up_latency_peak / 4;
+    wake_up_margin = std::min(std::max(margin, minimum_wake_up_margin), GetCycleTime() / 2);
+  }
+  return planned_cycle_start;
+}
+
+void tThreadContainerThread::WaitUntilPaused()
+{
+  while (executing_cycle)
+  {
+    rrlib::thread::tThread::Sleep(std::chrono::microseconds(100), false);
+  }
+  WaitForNonCriticalTasks();
 }
 
 //----------------------------------------------------------------------
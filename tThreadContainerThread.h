@@ -40,14 +40,23 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include "rrlib/thread/tLoopThread.h"
+#include "rrlib/thread/tConditionVariable.h"
 #include "rrlib/watchdog/tWatchDogTask.h"
-#include "core/tRuntimeListener.h"
 #include "plugins/data_ports/tOutputPort.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/scheduling/tBackgroundJob.h"
+#include "plugins/scheduling/tPerformanceCounters.h"
+#include "plugins/scheduling/tReleaseTable.h"
+#include "plugins/scheduling/tUtilizationWindow.h"
+#include "plugins/scheduling/tScheduleGraph.h"
+#include "plugins/scheduling/tSequenceLock.h"
+#include "plugins/scheduling/tSingleThreadedExecutor.h"
+#include "plugins/scheduling/tStatisticsSnapshot.h"
 #include "plugins/scheduling/tTaskProfile.h"
+#include "plugins/scheduling/tTelemetrySegment.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -61,6 +70,8 @@ namespace scheduling
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
 struct tPeriodicFrameworkElementTask;
+class tProfilePublisherThread;
+class tFlightRecorder;
 
 //----------------------------------------------------------------------
 // Class declaration
@@ -69,7 +80,7 @@ struct tPeriodicFrameworkElementTask;
 /*!
  * Thread that executes tasks inside thread container.
  */
-class tThreadContainerThread : public rrlib::thread::tLoopThread, public core::tRuntimeListener, public rrlib::watchdog::tWatchDogTask
+class tThreadContainerThread : public rrlib::thread::tLoopThread, public rrlib::watchdog::tWatchDogTask
 {
 
 //----------------------------------------------------------------------
@@ -79,10 +90,64 @@ public:
 
   tThreadContainerThread(core::tFrameworkElement& thread_container, rrlib::time::tDuration default_cycle_time,
                          bool warn_on_cycle_time_exceed, data_ports::tOutputPort<rrlib::time::tDuration> execution_duration,
-                         data_ports::tOutputPort<std::vector<tTaskProfile>> execution_details);
+                         data_ports::tOutputPort<std::vector<tTaskProfile>> execution_details,
+                         data_ports::tOutputPort<rrlib::serialization::tMemoryBuffer> execution_details_compact);
 
   virtual ~tThreadContainerThread();
 
+  /*!
+   * Enables maintaining execution statistics for GetStatisticsSnapshot()
+   * (execution durations are measured in every cycle then)
+   */
+  void EnableStatisticsSnapshots()
+  {
+    statistics_snapshots = true;
+    reschedule = true;
+  }
+
+  /*!
+   * Enables time-triggered mode for this thread container:
+   * After a calibration phase (with tasks executed back to back), a static table with a release offset
+   * (relative to the actual start of the first task in a cycle) for each task in the execution plan is computed from the measured maximum
+   * execution durations plus a margin (see tReleaseTable). From then on, each task is released exactly at its offset -
+   * and tasks that start more than tReleaseTable::cTOLERANCE after their offset (because a predecessor exceeded its budget)
+   * are counted as release offset violations. The table is recomputed (after calibration) when the schedule changes.
+   * In mixed-criticality mode, the table only covers critical tasks (non-critical tasks are executed by companion thread).
+   * Must be called before thread is started.
+   *
+   * \param calibration_cycles Number of cycles to measure execution durations before computing release table
+   * \param budget_margin Relative margin added to maximum execution duration of each task to obtain its budget (e.g. 0.25)
+   * \param release_offset_violations Port to publish number of release offset violations to
+   */
+  void EnableTimeTriggeredMode(size_t calibration_cycles, double budget_margin, data_ports::tOutputPort<unsigned int> release_offset_violations);
+
+  /*!
+   * Enables utilization monitoring: thread container computes and publishes its utilization every cycle
+   * (independent of whether profiling is enabled - if it is, utilization is published by profile publisher thread).
+   * Only requires two timestamps around the tasks of a cycle.
+   *
+   * \param window_size Number of cycles in sliding window for minimum, average and maximum values
+   * \param utilization Port to publish utilization to
+   */
+  void EnableUtilizationMonitoring(size_t window_size, data_ports::tOutputPort<tUtilization> utilization);
+
+  /*!
+   * Adds background job that is executed in the slack at the end of each cycle (see tBackgroundJob)
+   *
+   * \param job Job to add (must exist until it is removed or returns false in ExecuteSlice())
+   */
+  void AddBackgroundJob(tBackgroundJob& job);
+
+  /*!
+   * Enables flight recorder for this thread container (see tFlightRecorder).
+   * Must be called before thread is started.
+   *
+   * \param cycle_count Number of cycles to keep in ring buffer
+   * \param overrun_threshold Dump is triggered when the execution of a cycle exceeds the cycle time by this fraction (e.g. 0.5 for 50%) - negative values disable this trigger
+   * \param dump_directory Directory to write dump files to
+   */
+  void EnableFlightRecorder(size_t cycle_count, double overrun_threshold, const std::string& dump_directory);
+
   /*!
    * \return Returns pointer to current thread if it is a tThreadContainerThread - NULL otherwise
    */
@@ -92,7 +157,7 @@ public:
     rrlib::thread::tThread& thread = rrlib::thread::tThread::CurrentThread();
     return (typeid(thread) == typeid(tThreadContainerThread)) ? static_cast<tThreadContainerThread*>(&thread) : NULL;
 #else
-    return single_thread_container;
+    return tSingleThreadedExecutor::GetInstance().GetCurrentContainer();
 #endif
   }
 
@@ -106,6 +171,17 @@ public:
     return current_cycle_start_application_time;
   }
 
+  /*!
+   * Copies current execution statistics of thread container and its tasks.
+   * Can be called from any thread at high rate: the thread container thread never blocks
+   * (it merely updates the statistics protected by a sequence lock at the end of each cycle)
+   * and readers do not lock anything either (they retry if statistics were modified while copying).
+   * Statistics are only maintained if enabled (see EnableStatisticsSnapshots()).
+   *
+   * \param snapshot Object to copy statistics to (reusing its memory)
+   */
+  void GetStatisticsSnapshot(tStatisticsSnapshot& snapshot);
+
   /*!
    * \return Shared Pointer to thread container thread
    */
@@ -114,10 +190,153 @@ public:
     return std::static_pointer_cast<tThreadContainerThread>(tThread::GetSharedPtr());
   }
 
+  /*!
+   * \return True if pausing execution was requested (see RequestPause()) and execution has not been resumed yet
+   */
+  bool IsPauseRequested() const
+  {
+    return pause_requested.load();
+  }
+
+  /*!
+   * Enables mixed-criticality mode for this thread container:
+   * Only initial, sense and control tasks are executed by this (possibly real-time) thread.
+   * Other (non-critical) tasks are handed over to a companion thread (with normal priority)
+   * after the control tasks have been executed. If the companion thread has not completed
+   * the previous cycle at this point, it skips a cycle - which is counted as overrun.
+   * So timing of the critical tasks no longer depends on non-critical tasks.
+   * Must be called before thread is started.
+   *
+   * \param non_critical_execution_duration Port to publish execution duration of non-critical tasks in companion thread
+   * \param non_critical_overruns Port to publish number of cycles that companion thread had to skip
+   */
+  void EnableMixedCriticality(data_ports::tOutputPort<rrlib::time::tDuration> non_critical_execution_duration,
+                              data_ports::tOutputPort<unsigned int> non_critical_overruns);
+
+  /*!
+   * Enables precise wait mode for this thread container.
+   * In this mode, the thread sleeps (as usual) and then busy-waits on a monotonic clock
+   * for a margin - so that cycles start with significantly less jitter.
+   * The margin is tuned automatically from observed wake-up latency.
+   * Must be called before thread is started.
+   *
+   * \param initial_margin Initial margin to busy-wait (also minimum)
+   * \param spin_duration Port to publish time spent busy-waiting in each cycle (CPU cost of precise wait mode)
+   */
+  void EnablePreciseWait(rrlib::time::tDuration initial_margin, data_ports::tOutputPort<rrlib::time::tDuration> spin_duration);
+
+  /*!
+   * Executes one cycle in the calling thread (e.g. for test programs - see tThreadContainerElement::ExecuteCycle()).
+   * This thread must not be executing cycles itself: it must either not have been started - or be paused.
+   */
+  void ExecuteCycle()
+  {
+    manual_cycle = true;
+    MainLoopCallback();
+    manual_cycle = false;
+  }
+
+  /*!
+   * \return Thread container that thread belongs to
+   */
+  core::tFrameworkElement& GetThreadContainer()
+  {
+    return thread_container;
+  }
+
+  /*!
+   * \return Current margin that thread busy-waits for before cycle start (zero if precise wait is not enabled)
+   */
+  rrlib::time::tDuration GetWakeUpMargin() const
+  {
+    return wake_up_margin;
+  }
+
   virtual void MainLoopCallback() override;
 
+  /*!
+   * Removes background job (blocks if job is currently executing)
+   *
+   * \param job Job to remove
+   */
+  void RemoveBackgroundJob(tBackgroundJob& job);
+
+  /*!
+   * Requests that thread pauses execution after the current cycle (does not block).
+   * The thread is parked and keeps its schedule. Structure changes are still tracked,
+   * so that rescheduling is only performed on resume if they actually affect this container.
+   */
+  void RequestPause();
+
+  /*!
+   * \param safety_margin Background jobs are stopped this duration before the next cycle is due to start
+   */
+  void SetBackgroundJobSafetyMargin(const rrlib::time::tDuration& safety_margin)
+  {
+    background_job_safety_margin = safety_margin;
+  }
+
+  /*!
+   * \param reschedule_count Port to publish number of schedule rebuilds to (published whenever schedule is rebuilt)
+   */
+  void SetRescheduleCountPort(data_ports::tOutputPort<unsigned int> reschedule_count)
+  {
+    this->reschedule_count_port = reschedule_count;
+  }
+
+  /*!
+   * Sets whether independent tasks are ordered locality-aware:
+   * Among tasks that are ready, those whose predecessor (producer) was scheduled most recently are executed first.
+   * This way, consumers are placed as close as possible after their producers - while their output buffers are still in cache.
+   * Triggers rescheduling.
+   *
+   * \param locality_aware_ordering Whether to enable locality-aware ordering
+   */
+  void SetLocalityAwareOrdering(bool locality_aware_ordering)
+  {
+    this->locality_aware_ordering = locality_aware_ordering;
+    reschedule = true;
+  }
+
+  /*!
+   * Requests that thread reschedules before its next cycle
+   * (called by tRuntimeChangeDispatcher if relevant structure of thread container changed)
+   */
+  void RequestReschedule()
+  {
+    reschedule = true;
+  }
+
+  /*!
+   * Requests dump of flight recorder at the end of the current cycle (if flight recorder is enabled)
+   */
+  void RequestFlightRecorderDump();
+
+  /*!
+   * Resumes execution of thread paused with RequestPause()
+   */
+  void Resume();
+
+  /*!
+   * Sets time at which the first cycle after (re)starting execution is to begin (for synchronized start - see tExecutionControl::StartAll()).
+   * Must be called before Start() or Resume().
+   * A thread that has not entered its loop yet (started or prepared) waits for this time before it does - so the following cycles are aligned to it as well.
+   * A parked thread waits for this time before its first cycle after resuming.
+   *
+   * \param start_time Start time of first cycle (cNO_TIME to start immediately)
+   */
+  void SetStartTime(const rrlib::time::tTimestamp& start_time)
+  {
+    this->start_time.store(start_time);
+  }
+
   virtual void Run() override;
 
+  /*!
+   * Blocks until thread has completed the cycle it was executing when RequestPause() was called
+   */
+  void WaitUntilPaused();
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
@@ -129,15 +348,95 @@ private:
   /*! true, when thread needs to make a new schedule before next run */
   std::atomic<bool> reschedule;
 
+  /*! true, when thread was requested to pause execution */
+  std::atomic<bool> pause_requested;
+
+  /*! true, while thread is executing a cycle */
+  std::atomic<bool> executing_cycle;
+
+  /*! true, while a cycle is executed manually (see ExecuteCycle()) */
+  bool manual_cycle;
+
+  /*! Start time of first cycle after (re)starting execution (see SetStartTime()) - cNO_TIME if none is set */
+  std::atomic<rrlib::time::tTimestamp> start_time;
+
   /*!
    * simple schedule: Tasks will be executed in specified order
    * There are four sets of tasks: [initial tasks, sense tasks, control tasks, other tasks]
    */
   std::vector<tPeriodicFrameworkElementTask*> schedule;
 
+  /*! Version of schedule (incremented whenever rescheduling) */
+  uint32_t schedule_version;
+
   /*! Indices where the different sets of tasks start in the schedule */
   size_t task_set_first_index[4];
 
+  /*! Scheduling data built when rescheduling (kept to reuse its memory) */
+  tScheduleGraph schedule_graph;
+
+  /*!
+   * Entry in execution plan.
+   * Contains everything the execution loop needs to execute a task and fill its profile
+   * (so that it does not need to dereference task annotation and framework element in every cycle)
+   */
+  struct tScheduledTask
+  {
+    /*! Task to execute */
+    rrlib::thread::tTask* task;
+
+    /*! Annotation of task to execute */
+    tPeriodicFrameworkElementTask* task_annotation;
+
+    /*! Handle of framework element associated with task */
+    core::tFrameworkElement::tHandle handle;
+
+    /*! Classification of task */
+    tTaskClassification classification;
+
+    /*! Is this an event-triggered task? */
+    bool event_triggered;
+
+    /*! Does this thread container own the task? (false until task has been claimed - see tPeriodicFrameworkElementTask::Claim()) */
+    bool owned;
+  };
+
+  /*!
+   * Execution statistics of the tasks in the execution plan (stored as structure of arrays).
+   * Index in each vector is the task's index in the execution plan.
+   */
+  struct tTaskStatistics
+  {
+    /*! Total execution duration of task */
+    std::vector<rrlib::time::tDuration> total_execution_duration;
+
+    /*! Maximum execution duration of task */
+    std::vector<rrlib::time::tDuration> max_execution_duration;
+
+    /*! Number of times that task was executed */
+    std::vector<int64_t> execution_count;
+
+    /*! Last execution duration of task */
+    std::vector<rrlib::time::tDuration> last_execution_duration;
+
+    void Resize(size_t size)
+    {
+      last_execution_duration.resize(size, rrlib::time::tDuration::zero());
+      total_execution_duration.resize(size, rrlib::time::tDuration::zero());
+      max_execution_duration.resize(size, rrlib::time::tDuration::zero());
+      execution_count.resize(size, 0);
+    }
+  };
+
+  /*!
+   * Compiled execution plan: contiguous array with one entry for each task in schedule (same order).
+   * Created whenever rescheduling.
+   */
+  std::vector<tScheduledTask> execution_plan;
+
+  /*! Execution statistics of tasks in execution plan */
+  tTaskStatistics task_statistics;
+
   /*! Port to publish time spent in last call to MainLoopCallback() */
   data_ports::tOutputPort<rrlib::time::tDuration> execution_duration;
 
@@ -148,6 +447,176 @@ private:
    */
   data_ports::tOutputPort<std::vector<tTaskProfile>> execution_details;
 
+  /*! Thread that publishes profiling information (only created if profiling is enabled) */
+  std::shared_ptr<tProfilePublisherThread> profile_publisher;
+
+  /*! Ports to publish execution durations of tasks in execution plan (only created if profiling is enabled) */
+  std::shared_ptr<std::vector<data_ports::tOutputPort<rrlib::time::tDuration>>> task_duration_ports;
+
+  /*! Slot in shared memory telemetry segment (only acquired if profiling and shared memory telemetry are enabled) */
+  tTelemetrySegment::tContainerSlot* telemetry_slot;
+
+  /*! Flight recorder (only created if enabled) */
+  std::shared_ptr<tFlightRecorder> flight_recorder;
+
+  /*! Performance counters of this thread (only opened if profiling and performance counter profiling are enabled - in Run()) */
+  std::unique_ptr<tPerformanceCounters> performance_counters;
+
+  /*! Is locality-aware ordering of independent tasks enabled? (see SetLocalityAwareOrdering()) */
+  std::atomic<bool> locality_aware_ordering;
+
+  /*! Sliding window for utilization statistics (only created if utilization monitoring is enabled) */
+  std::unique_ptr<tUtilizationWindow> utilization_window;
+
+  /*! Port to publish utilization to (see EnableUtilizationMonitoring()) */
+  data_ports::tOutputPort<tUtilization> utilization_port;
+
+  /*! Utilization statistics to publish (member to avoid reallocation) */
+  tUtilization utilization;
+
+  /*! Number of schedule rebuilds so far */
+  unsigned int reschedule_count;
+
+  /*! Port to publish number of schedule rebuilds to (see SetRescheduleCountPort()) */
+  data_ports::tOutputPort<unsigned int> reschedule_count_port;
+
+  /*! Background jobs executed in slack at the end of each cycle */
+  std::vector<tBackgroundJob*> background_jobs;
+
+  /*! Mutex for background job list (locked while background jobs are executed) */
+  rrlib::thread::tMutex background_job_mutex;
+
+  /*! Index of background job to execute first in next cycle (jobs are executed round-robin) */
+  size_t next_background_job;
+
+  /*! Background jobs are stopped this duration before the next cycle is due to start */
+  rrlib::time::tDuration background_job_safety_margin;
+
+  class tNonCriticalTaskThread;
+
+  /*! Companion thread executing non-critical tasks in mixed-criticality mode (see EnableMixedCriticality()) */
+  std::shared_ptr<tNonCriticalTaskThread> non_critical_task_thread;
+
+  /*! Mutex for synchronization with companion thread */
+  rrlib::thread::tMutex non_critical_task_mutex;
+
+  /*! Signals companion thread that it should execute non-critical tasks - and this thread that it has completed them */
+  rrlib::thread::tConditionVariable non_critical_task_signal;
+
+  /*! Is companion thread currently executing non-critical tasks? (only accessed with mutex locked) */
+  bool non_critical_tasks_executing;
+
+  /*! Cycle start passed to companion thread for claiming migrated tasks */
+  rrlib::time::tTimestamp non_critical_cycle_start;
+
+  /*! Number of cycles that companion thread had to skip, because it had not completed the previous one */
+  unsigned int non_critical_overrun_count;
+
+  /*!
+   * Execution duration of each non-critical task in the companion thread's last cycle (negative if task was not executed).
+   * Written by companion thread while executing - and added to task statistics by this thread afterwards (see CollectNonCriticalTaskDurations())
+   */
+  std::vector<rrlib::time::tDuration> non_critical_task_durations;
+
+  /*! Have durations in non_critical_task_durations been recorded since they were last added to task statistics? (only accessed with mutex locked) */
+  bool non_critical_task_durations_pending;
+
+  /*! Port to publish execution duration of non-critical tasks to */
+  data_ports::tOutputPort<rrlib::time::tDuration> non_critical_execution_duration;
+
+  /*! Port to publish number of cycles skipped by companion thread to */
+  data_ports::tOutputPort<unsigned int> non_critical_overruns;
+
+  /*! Are statistics maintained for GetStatisticsSnapshot()? */
+  std::atomic<bool> statistics_snapshots;
+
+  /*!
+   * Storage for statistics for GetStatisticsSnapshot() - written by this thread only.
+   * Vectors are allocated with their final capacity and are never resized (only 'size' changes),
+   * so that readers can copy from storage without locking while this thread writes to it.
+   */
+  struct tStatisticsSnapshotStorage
+  {
+    /*! Number of cycles executed (see tStatisticsSnapshot) */
+    uint64_t cycle_count;
+
+    /*! Version of schedule that statistics refer to */
+    uint32_t schedule_version;
+
+    /*! Number of valid elements in profiles and execution_counts */
+    size_t size;
+
+    /*! Profiles with statistics - index as in tStatisticsSnapshot (only the first 'size' elements are valid) */
+    std::vector<tTaskProfile> profiles;
+
+    /*! Execution counts - index as in profiles (only the first 'size' elements are valid) */
+    std::vector<uint64_t> execution_counts;
+
+    tStatisticsSnapshotStorage(size_t capacity) :
+      cycle_count(0),
+      schedule_version(0),
+      size(0),
+      profiles(capacity),
+      execution_counts(capacity, 0)
+    {}
+  };
+
+  /*!
+   * All storages allocated for statistics snapshots (the last one is current).
+   * When more capacity is needed after rescheduling, a larger storage is added:
+   * previous storages are retained until this thread is deleted, as readers might still be copying from them.
+   * As capacity at least doubles, they occupy less memory than the current one.
+   */
+  std::vector<std::unique_ptr<tStatisticsSnapshotStorage>> statistics_snapshot_storages;
+
+  /*! Current storage for statistics snapshots (nullptr if statistics snapshots have not been initialized yet) */
+  std::atomic<tStatisticsSnapshotStorage*> statistics_snapshot_storage;
+
+  /*! Sequence lock protecting statistics_snapshot_storage and its contents */
+  tSequenceLock statistics_snapshot_lock;
+
+  /*! Is time-triggered mode enabled? (see EnableTimeTriggeredMode()) */
+  bool time_triggered;
+
+  /*! Number of cycles to measure execution durations before computing release table in time-triggered mode */
+  size_t time_triggered_calibration_cycles;
+
+  /*! Relative margin added to maximum execution duration of each task to obtain its budget in time-triggered mode */
+  double time_triggered_budget_margin;
+
+  /*! Number of calibration cycles executed since schedule was last rebuilt */
+  size_t time_triggered_calibrated_cycle_count;
+
+  /*! Release offsets of (critical) tasks in execution plan relative to start of first task in time-triggered mode (empty while calibrating) */
+  tReleaseTable release_table;
+
+  /*! Number of release offset violations so far */
+  unsigned int release_offset_violation_count;
+
+  /*! Port to publish number of release offset violations to */
+  data_ports::tOutputPort<unsigned int> release_offset_violations;
+
+  /*! Is precise wait mode enabled? (see EnablePreciseWait()) */
+  bool precise_wait;
+
+  /*! Minimum margin for busy-waiting in precise wait mode */
+  rrlib::time::tDuration minimum_wake_up_margin;
+
+  /*!
+   * Margin that thread busy-waits for before cycle start in precise wait mode.
+   * Cycles start this margin after tLoopThread's (sleep-based) wake-up time.
+   */
+  rrlib::time::tDuration wake_up_margin;
+
+  /*! Decaying peak of observed wake-up latency of sleep-based waiting (used to tune margin) */
+  rrlib::time::tDuration wake_up_latency_peak;
+
+  /*! Time spent busy-waiting in last cycle */
+  rrlib::time::tDuration last_spin_duration;
+
+  /*! Port to publish time spent busy-waiting in each cycle */
+  data_ports::tOutputPort<rrlib::time::tDuration> spin_duration;
+
   /*! Total execution duration of thread */
   rrlib::time::tDuration total_execution_duration;
 
@@ -166,16 +635,86 @@ private:
   /*! Start time of current control cycle in application time */
   rrlib::time::tTimestamp current_cycle_start_application_time;
 
-  /*! Contains pointer to the only thread container in single threaded mode */
-  static tThreadContainerThread* single_thread_container;
+  /*!
+   * \return Number of critical tasks at the beginning of execution plan (executed by this thread - the others are executed by companion thread in mixed-criticality mode)
+   */
+  size_t GetCriticalTaskCount() const;
+
+  /*!
+   * \return Whether current cycle is executed periodically by this thread (false if it is executed manually - see ExecuteCycle())
+   */
+  bool IsExecutingPeriodically() const
+  {
+    return this->IsAlive() && (!manual_cycle);
+  }
+
+  /*!
+   * \param aggregator Edge aggregator
+   * \return Whether edge aggregator is scheduled by this thread container (considering migrated tasks)
+   */
+  bool IsScheduledHere(core::tEdgeAggregator& aggregator);
+
+  /*!
+   * Updates statistics for GetStatisticsSnapshot() at the end of a cycle
+   *
+   * \param duration Execution duration of cycle
+   */
+  void UpdateStatisticsSnapshot(rrlib::time::tDuration duration);
+
+  /*!
+   * Computes table with release offsets in time-triggered mode from measured execution durations
+   */
+  void ComputeReleaseTable();
+
+  /*!
+   * Adds durations of non-critical tasks that companion thread recorded in its last cycle to task statistics
+   * (so that they are included in profiles, statistics snapshots etc. - with a delay of one cycle)
+   *
+   * \param update_statistics Whether to update task statistics (otherwise, durations are only made available in non_critical_task_durations)
+   * \return True if durations were collected (then non_critical_task_durations contains the values until the next handover to companion thread)
+   */
+  bool CollectNonCriticalTaskDurations(bool update_statistics);
+
+  /*!
+   * Executes non-critical tasks in mixed-criticality mode (called by companion thread - or by this thread if companion is not running).
+   * Execution durations are recorded in non_critical_task_durations (they are published via this thread's profile publisher).
+   */
+  void ExecuteNonCriticalTasks();
+
+  /*!
+   * Blocks until companion thread has completed executing non-critical tasks (in mixed-criticality mode)
+   */
+  void WaitForNonCriticalTasks();
+
+  /*!
+   * Executes background jobs in slices until shortly before the next cycle is due to start
+   * (or pausing is requested)
+   */
+  void ExecuteBackgroundJobs();
+
+  /*!
+   * Waits precisely until specified time - e.g. release time of task in time-triggered mode or start time
+   * (returns immediately if time has already passed)
+   *
+   * \param time Time to wait for
+   */
+  void WaitUntil(const rrlib::time::tTimestamp& time);
+
+  /*!
+   * Waits precisely for planned cycle start (tLoopThread wake-up time + margin) by busy-waiting
+   * on monotonic clock. Afterwards, margin is tuned based on the observed wake-up latency.
+   *
+   * \return Planned cycle start
+   */
+  rrlib::time::tTimestamp WaitForCycleStart();
 
   /*!
    * Helper function for debug output.
    *
-   * \param task_list List of tasks
+   * \param task_list List of tasks (indices in schedule graph - each task is a predecessor of the task before)
    * \return String with fully-qualified names of each attached framework element of list elements in a new line
    */
-  std::string CreateLoopDebugOutput(const std::vector<tPeriodicFrameworkElementTask*>& task_list);
+  std::string CreateLoopDebugOutput(const std::vector<uint32_t>& task_list);
 
   /*!
    * Applies function to each task connected with specified edge aggregator.
@@ -205,11 +744,20 @@ private:
    */
   static bool IsModuleInputInterface(core::tFrameworkElement& fe);
 
-  virtual void HandleWatchdogAlert() override;
+  /*!
+   * Creates new schedule and execution plan for tasks in thread container
+   * (statistics of tasks that were already scheduled are retained)
+   */
+  void Reschedule();
 
-  virtual void OnEdgeChange(core::tRuntimeListener::tEvent change_type, core::tAbstractPort& source, core::tAbstractPort& target) override;
+  /*!
+   * Writes profiles of current cycle to shared memory telemetry segment
+   *
+   * \param profiles Profiles of container and executed tasks
+   */
+  void WriteTelemetry(const std::vector<tTaskProfile>& profiles);
 
-  virtual void OnFrameworkElementChange(core::tRuntimeListener::tEvent change_type, core::tFrameworkElement& element) override;
+  virtual void HandleWatchdogAlert() override;
 };
 
 //----------------------------------------------------------------------
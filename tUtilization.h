@@ -0,0 +1,143 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tUtilization.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tUtilization
+ *
+ * \b tUtilization
+ *
+ * Utilization of a thread container: share of its cycle time spent executing
+ * tasks - and the remaining headroom. Besides values of the last cycle,
+ * contains minimum, average and maximum over a sliding window of cycles.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tUtilization_h__
+#define __plugins__scheduling__tUtilization_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/serialization/serialization.h"
+#include "rrlib/time/time.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Thread container utilization
+/*!
+ * Utilization of a thread container: share of its cycle time spent executing tasks - and the remaining headroom.
+ * Besides values of the last cycle, contains minimum, average and maximum over a sliding window of cycles
+ * (see tUtilizationWindow).
+ * A thread container publishes this every cycle - also if profiling is disabled.
+ */
+struct tUtilization
+{
+  /*! Cycle time of thread container */
+  rrlib::time::tDuration cycle_time;
+
+  /*! Utilization in last cycle (execution duration / cycle time - values above 1 mean that cycle time was exceeded) */
+  double last_utilization;
+
+  /*! Minimum utilization in window */
+  double min_utilization;
+
+  /*! Average utilization in window */
+  double average_utilization;
+
+  /*! Maximum utilization in window */
+  double max_utilization;
+
+  /*! Headroom in last cycle (cycle time - execution duration; negative if cycle time was exceeded) */
+  rrlib::time::tDuration last_headroom;
+
+  /*! Minimum headroom in window */
+  rrlib::time::tDuration min_headroom;
+
+  /*! Average headroom in window */
+  rrlib::time::tDuration average_headroom;
+
+  /*! Maximum headroom in window */
+  rrlib::time::tDuration max_headroom;
+
+  /*! Number of cycles in window (smaller than window size until enough cycles have been executed) */
+  uint32_t window_cycle_count;
+
+  tUtilization() :
+    cycle_time(0),
+    last_utilization(0),
+    min_utilization(0),
+    average_utilization(0),
+    max_utilization(0),
+    last_headroom(0),
+    min_headroom(0),
+    average_headroom(0),
+    max_headroom(0),
+    window_cycle_count(0)
+  {}
+};
+
+inline rrlib::serialization::tOutputStream &operator << (rrlib::serialization::tOutputStream &stream, const tUtilization &utilization)
+{
+  stream << utilization.cycle_time << utilization.last_utilization << utilization.min_utilization << utilization.average_utilization
+         << utilization.max_utilization << utilization.last_headroom << utilization.min_headroom << utilization.average_headroom
+         << utilization.max_headroom << utilization.window_cycle_count;
+  return stream;
+}
+
+inline rrlib::serialization::tInputStream &operator >> (rrlib::serialization::tInputStream &stream, tUtilization &utilization)
+{
+  stream >> utilization.cycle_time >> utilization.last_utilization >> utilization.min_utilization >> utilization.average_utilization
+         >> utilization.max_utilization >> utilization.last_headroom >> utilization.min_headroom >> utilization.average_headroom
+         >> utilization.max_headroom >> utilization.window_cycle_count;
+  return stream;
+}
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
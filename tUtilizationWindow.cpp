@@ -0,0 +1,141 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tUtilizationWindow.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tUtilizationWindow.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tUtilizationWindow::tUtilizationWindow(size_t size) :
+  durations(std::max<size_t>(1, size), rrlib::time::tDuration::zero()),
+  sample_count(0),
+  sum(0),
+  min_queue(durations.size()),
+  max_queue(durations.size())
+{}
+
+void tUtilizationWindow::Add(rrlib::time::tDuration execution_duration, rrlib::time::tDuration cycle_time, tUtilization& result)
+{
+  // Remove sample that leaves window
+  uint64_t sample = sample_count;
+  if (sample >= durations.size())
+  {
+    uint64_t expired = sample - durations.size();
+    sum -= durations[expired % durations.size()];
+    for (tMonotonicQueue * queue : { &min_queue, &max_queue })
+    {
+      if (queue->front < queue->back && queue->Front() == expired)
+      {
+        queue->front++;
+      }
+    }
+  }
+
+  // Add new sample
+  durations[sample % durations.size()] = execution_duration;
+  sum += execution_duration;
+  sample_count++;
+  Push(min_queue, sample, false);
+  Push(max_queue, sample, true);
+
+  // Compute statistics
+  size_t window_cycle_count = std::min<uint64_t>(sample_count, durations.size());
+  rrlib::time::tDuration min_duration = durations[min_queue.Front() % durations.size()];
+  rrlib::time::tDuration max_duration = durations[max_queue.Front() % durations.size()];
+  rrlib::time::tDuration average_duration(sum.count() / static_cast<int64_t>(window_cycle_count));
+  double cycle_time_value = std::max<double>(1, cycle_time.count());
+  result.cycle_time = cycle_time;
+  result.last_utilization = execution_duration.count() / cycle_time_value;
+  result.min_utilization = min_duration.count() / cycle_time_value;
+  result.average_utilization = average_duration.count() / cycle_time_value;
+  result.max_utilization = max_duration.count() / cycle_time_value;
+  result.last_headroom = cycle_time - execution_duration;
+  result.min_headroom = cycle_time - max_duration;
+  result.average_headroom = cycle_time - average_duration;
+  result.max_headroom = cycle_time - min_duration;
+  result.window_cycle_count = static_cast<uint32_t>(window_cycle_count);
+}
+
+void tUtilizationWindow::Push(tMonotonicQueue& queue, uint64_t sample, bool descending)
+{
+  rrlib::time::tDuration value = durations[sample % durations.size()];
+  while (queue.front < queue.back)
+  {
+    rrlib::time::tDuration back_value = durations[queue.Back() % durations.size()];
+    if (descending ? (back_value > value) : (back_value < value))
+    {
+      break;
+    }
+    queue.back--;
+  }
+  queue.back++;
+  queue.Back() = sample;
+}
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
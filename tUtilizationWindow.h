@@ -0,0 +1,162 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tUtilizationWindow.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tUtilizationWindow
+ *
+ * \b tUtilizationWindow
+ *
+ * Sliding window over execution durations of the last cycles of a thread container.
+ * Computes the statistics in tUtilization with constant effort per cycle
+ * (minimum and maximum are maintained in monotonic queues) - and without
+ * allocating memory after construction.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tUtilizationWindow_h__
+#define __plugins__scheduling__tUtilizationWindow_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tUtilization.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Sliding utilization window
+/*!
+ * Sliding window over execution durations of the last cycles of a thread container.
+ * Computes the statistics in tUtilization with constant effort per cycle
+ * (minimum and maximum are maintained in monotonic queues) - and without
+ * allocating memory after construction.
+ */
+class tUtilizationWindow
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param size Number of cycles in window
+   */
+  tUtilizationWindow(size_t size);
+
+  /*!
+   * Adds execution duration of cycle to window
+   *
+   * \param execution_duration Execution duration of cycle
+   * \param cycle_time Current cycle time of thread container
+   * \param result Utilization statistics are written to this object
+   *                (headroom statistics are relative to current cycle time)
+   */
+  void Add(rrlib::time::tDuration execution_duration, rrlib::time::tDuration cycle_time, tUtilization& result);
+
+  /*!
+   * \return Number of cycles in window
+   */
+  size_t GetSize() const
+  {
+    return durations.size();
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Monotonic queue storing numbers of samples in window (ring buffer) */
+  struct tMonotonicQueue
+  {
+    /*! Sample numbers (ring buffer with same size as window) */
+    std::vector<uint64_t> samples;
+
+    /*! Number of elements popped from front and pushed to back so far */
+    uint64_t front, back;
+
+    tMonotonicQueue(size_t size) : samples(size, 0), front(0), back(0) {}
+
+    uint64_t& Back()
+    {
+      return samples[(back - 1) % samples.size()];
+    }
+
+    uint64_t& Front()
+    {
+      return samples[front % samples.size()];
+    }
+  };
+
+  /*! Execution durations in window (ring buffer) */
+  std::vector<rrlib::time::tDuration> durations;
+
+  /*! Number of samples added so far */
+  uint64_t sample_count;
+
+  /*! Sum of execution durations in window */
+  rrlib::time::tDuration sum;
+
+  /*! Queues with ascending (for minimum) and descending (for maximum) durations */
+  tMonotonicQueue min_queue, max_queue;
+
+  /*!
+   * Adds new sample to monotonic queue
+   *
+   * \param queue Queue
+   * \param sample Sample number (duration must already be stored in durations)
+   * \param descending Whether queue is sorted descending (otherwise ascending)
+   */
+  void Push(tMonotonicQueue& queue, uint64_t sample, bool descending);
+};
+
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,173 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tests/release_table.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * Tests for tReleaseTable: simulates cycles in time-triggered mode the way
+ * tThreadContainerThread executes them (without sleeping) and counts release offset violations.
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tReleaseTable.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+class TestReleaseTable : public rrlib::util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestReleaseTable);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestOffsets);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestWellBehavedSchedule);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestOverrun);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+  /*!
+   * Simulates one cycle in time-triggered mode: like tThreadContainerThread, tasks are released by the release table.
+   * Waiting for release time is simulated: tasks start at their release time (plus delay) - or immediately after the previous task if it finished late.
+   *
+   * \param table Release table
+   * \param wake_up Time thread starts executing first task (may be late compared to planned cycle start)
+   * \param durations Actual execution durations of tasks in this cycle
+   * \param release_delay Delay between release time and actual start of each task (e.g. timer resolution)
+   * \return Number of release offset violations in cycle
+   */
+  unsigned int SimulateCycle(tReleaseTable& table, rrlib::time::tTimestamp wake_up, const std::vector<rrlib::time::tDuration>& durations, rrlib::time::tDuration release_delay)
+  {
+    unsigned int violations = 0;
+    rrlib::time::tTimestamp now = wake_up;
+    table.BeginCycle();
+    for (size_t i = 0; i < table.GetSize(); i++)
+    {
+      if (table.GetReleaseTime(i) != rrlib::time::cNO_TIME)
+      {
+        now = std::max(now, table.GetReleaseTime(i) + release_delay);
+      }
+      if (table.RecordTaskStart(i, now))
+      {
+        violations++;
+      }
+      now += durations[i];
+    }
+    return violations;
+  }
+
+  void TestOffsets()
+  {
+    tReleaseTable table;
+    RRLIB_UNIT_TESTS_ASSERT(table.IsEmpty());
+    std::vector<rrlib::time::tDuration> max_durations = { std::chrono::microseconds(100), std::chrono::microseconds(200), std::chrono::microseconds(400), std::chrono::microseconds(800) };
+    table.Compute(max_durations, 3, 0.5);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), table.GetSize());
+    RRLIB_UNIT_TESTS_EQUALITY(rrlib::time::tDuration::zero(), table.GetOffset(0));
+    RRLIB_UNIT_TESTS_EQUALITY(rrlib::time::tDuration(std::chrono::microseconds(150)), table.GetOffset(1));
+    RRLIB_UNIT_TESTS_EQUALITY(rrlib::time::tDuration(std::chrono::microseconds(450)), table.GetOffset(2));
+    RRLIB_UNIT_TESTS_EQUALITY(rrlib::time::tDuration(std::chrono::microseconds(1050)), table.GetTotalBudget());
+    table.Clear();
+    RRLIB_UNIT_TESTS_ASSERT(table.IsEmpty());
+  }
+
+  void TestWellBehavedSchedule()
+  {
+    tReleaseTable table;
+    std::vector<rrlib::time::tDuration> max_durations = { std::chrono::microseconds(300), std::chrono::microseconds(50), std::chrono::microseconds(1000) };
+    table.Compute(max_durations, max_durations.size(), 0.25);
+
+    // Tasks with jitter - but within their measured maximum; thread wakes up late and tasks are released slightly late
+    std::vector<std::vector<rrlib::time::tDuration>> cycle_durations =
+    {
+      max_durations,
+      { std::chrono::microseconds(120), std::chrono::microseconds(10), std::chrono::microseconds(700) },
+      { std::chrono::microseconds(299), std::chrono::microseconds(49), std::chrono::microseconds(1) }
+    };
+    rrlib::time::tTimestamp cycle_start(std::chrono::seconds(1000));
+    unsigned int violations = 0;
+    for (size_t cycle = 0; cycle < 30; cycle++)
+    {
+      rrlib::time::tDuration wake_up_latency = std::chrono::microseconds(cycle * 37 % 500);
+      rrlib::time::tDuration release_delay = std::chrono::microseconds(cycle % 15);
+      violations += SimulateCycle(table, cycle_start + wake_up_latency, cycle_durations[cycle % cycle_durations.size()], release_delay);
+      cycle_start += std::chrono::milliseconds(2);
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(0u, violations);
+  }
+
+  void TestOverrun()
+  {
+    tReleaseTable table;
+    std::vector<rrlib::time::tDuration> max_durations = { std::chrono::microseconds(100), std::chrono::microseconds(100), std::chrono::microseconds(100) };
+    table.Compute(max_durations, max_durations.size(), 0.2);
+    rrlib::time::tTimestamp wake_up(std::chrono::seconds(1000));
+
+    // First task exceeds its budget clearly: second task is released late
+    RRLIB_UNIT_TESTS_EQUALITY(1u, SimulateCycle(table, wake_up, { std::chrono::microseconds(200), std::chrono::microseconds(50), std::chrono::microseconds(50) }, rrlib::time::tDuration::zero()));
+
+    // Exceeding budget by less than tolerance is no violation
+    RRLIB_UNIT_TESTS_EQUALITY(0u, SimulateCycle(table, wake_up, { std::chrono::microseconds(120) + tReleaseTable::cTOLERANCE, std::chrono::microseconds(50), std::chrono::microseconds(50) }, rrlib::time::tDuration::zero()));
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestReleaseTable);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
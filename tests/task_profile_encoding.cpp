@@ -0,0 +1,235 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tests/task_profile_encoding.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * Round-trip tests for tTaskProfileEncoder and tTaskProfileDecoder:
+ * key frames, delta frames, schedule changes and lost frames.
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tTaskProfileEncoding.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace scheduling
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+class TestTaskProfileEncoding : public rrlib::util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestTaskProfileEncoding);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestRoundTrip);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+  /*! Cycle time of simulated thread container */
+  const rrlib::time::tDuration cCYCLE_TIME = std::chrono::milliseconds(40);
+
+  /*!
+   * \return Profiles of a thread container with the specified task handles - with field values derived from 'seed'
+   */
+  std::vector<tTaskProfile> CreateProfiles(const std::vector<core::tFrameworkElement::tHandle>& handles, int64_t seed)
+  {
+    std::vector<tTaskProfile> profiles(handles.size());
+    for (size_t i = 0; i < profiles.size(); i++)
+    {
+      tTaskProfile& profile = profiles[i];
+      int64_t value = seed * 1000 + static_cast<int64_t>(i) * 37;
+      profile.handle = handles[i];
+      profile.task_classification = static_cast<tTaskClassification>(i % 3);
+      profile.last_execution_duration = rrlib::time::tDuration(value);
+      profile.max_execution_duration = rrlib::time::tDuration(value + (seed % 2) * 5000);
+      profile.average_execution_duration = rrlib::time::tDuration(value / 2);
+      profile.total_execution_duration = rrlib::time::tDuration(value * seed);
+      profile.last_cpu_time = rrlib::time::tDuration(value - 7);
+      profile.last_voluntary_context_switches = static_cast<uint32_t>(seed % 4);
+      profile.last_involuntary_context_switches = static_cast<uint32_t>(i);
+      profile.last_minor_page_faults = static_cast<uint32_t>(seed % 3);
+      profile.last_major_page_faults = 0;
+      profile.last_cycles = static_cast<uint64_t>(value * 3);
+      profile.last_instructions = static_cast<uint64_t>(value * 4);
+      profile.last_cache_misses = static_cast<uint64_t>(seed);
+      profile.last_branch_misses = static_cast<uint64_t>(seed % 5);
+    }
+    return profiles;
+  }
+
+  /*!
+   * Checks that all fields of decoded profiles equal the encoded ones
+   */
+  void AssertEqual(const std::vector<tTaskProfile>& expected, const std::vector<tTaskProfile>& decoded)
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(expected.size(), decoded.size());
+    for (size_t i = 0; i < expected.size() && i < decoded.size(); i++)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(expected[i].handle, decoded[i].handle);
+      RRLIB_UNIT_TESTS_ASSERT(expected[i].task_classification == decoded[i].task_classification);
+      RRLIB_UNIT_TESTS_ASSERT(expected[i].last_execution_duration == decoded[i].last_execution_duration);
+      RRLIB_UNIT_TESTS_ASSERT(expected[i].max_execution_duration == decoded[i].max_execution_duration);
+      RRLIB_UNIT_TESTS_ASSERT(expected[i].average_execution_duration == decoded[i].average_execution_duration);
+      RRLIB_UNIT_TESTS_ASSERT(expected[i].total_execution_duration == decoded[i].total_execution_duration);
+      RRLIB_UNIT_TESTS_ASSERT(expected[i].last_cpu_time == decoded[i].last_cpu_time);
+      RRLIB_UNIT_TESTS_EQUALITY(expected[i].last_voluntary_context_switches, decoded[i].last_voluntary_context_switches);
+      RRLIB_UNIT_TESTS_EQUALITY(expected[i].last_involuntary_context_switches, decoded[i].last_involuntary_context_switches);
+      RRLIB_UNIT_TESTS_EQUALITY(expected[i].last_minor_page_faults, decoded[i].last_minor_page_faults);
+      RRLIB_UNIT_TESTS_EQUALITY(expected[i].last_major_page_faults, decoded[i].last_major_page_faults);
+      RRLIB_UNIT_TESTS_EQUALITY(expected[i].last_cycles, decoded[i].last_cycles);
+      RRLIB_UNIT_TESTS_EQUALITY(expected[i].last_instructions, decoded[i].last_instructions);
+      RRLIB_UNIT_TESTS_EQUALITY(expected[i].last_cache_misses, decoded[i].last_cache_misses);
+      RRLIB_UNIT_TESTS_EQUALITY(expected[i].last_branch_misses, decoded[i].last_branch_misses);
+    }
+  }
+
+  /*!
+   * Encodes frame to buffer
+   *
+   * \return Size of encoded frame
+   */
+  size_t Encode(tTaskProfileEncoder& encoder, rrlib::serialization::tMemoryBuffer& buffer, const std::vector<tTaskProfile>& profiles,
+                uint32_t schedule_version, const rrlib::time::tTimestamp& time)
+  {
+    rrlib::serialization::tOutputStream stream(buffer);
+    encoder.Encode(stream, profiles, schedule_version, time);
+    stream.Close();
+    return buffer.GetSize();
+  }
+
+  /*!
+   * Decodes frame from buffer
+   *
+   * \return Whether frame could be decoded
+   */
+  bool Decode(tTaskProfileDecoder& decoder, const rrlib::serialization::tMemoryBuffer& buffer, std::vector<tTaskProfile>& profiles)
+  {
+    rrlib::serialization::tInputStream stream(buffer);
+    return decoder.Decode(stream, profiles);
+  }
+
+  void TestRoundTrip()
+  {
+    tTaskProfileEncoder encoder(std::chrono::seconds(1));
+    tTaskProfileDecoder decoder;
+    std::vector<core::tFrameworkElement::tHandle> handles = { 100, 101, 102, 103 };
+    std::vector<tTaskProfile> decoded;
+    rrlib::time::tTimestamp time(std::chrono::seconds(1000));
+    int64_t seed = 1;
+
+    // Key frame
+    rrlib::serialization::tMemoryBuffer key_frame;
+    std::vector<tTaskProfile> profiles = CreateProfiles(handles, seed);
+    size_t key_frame_size = Encode(encoder, key_frame, profiles, 1, time);
+    RRLIB_UNIT_TESTS_ASSERT(Decode(decoder, key_frame, decoded));
+    AssertEqual(profiles, decoded);
+
+    // Delta frames (smaller than key frame)
+    for (int i = 0; i < 10; i++)
+    {
+      rrlib::serialization::tMemoryBuffer delta_frame;
+      time += cCYCLE_TIME;
+      profiles = CreateProfiles(handles, ++seed);
+      size_t delta_frame_size = Encode(encoder, delta_frame, profiles, 1, time);
+      RRLIB_UNIT_TESTS_ASSERT(delta_frame_size < key_frame_size);
+      RRLIB_UNIT_TESTS_ASSERT(Decode(decoder, delta_frame, decoded));
+      AssertEqual(profiles, decoded);
+    }
+
+    // Schedule change: key frame with new tasks
+    handles = { 100, 102, 104 };
+    rrlib::time::tTimestamp key_frame_time = time + cCYCLE_TIME;
+    {
+      rrlib::serialization::tMemoryBuffer frame;
+      time += cCYCLE_TIME;
+      profiles = CreateProfiles(handles, ++seed);
+      Encode(encoder, frame, profiles, 2, time);
+      RRLIB_UNIT_TESTS_ASSERT(Decode(decoder, frame, decoded));
+      AssertEqual(profiles, decoded);
+    }
+
+    // Lost frame: following delta frames cannot be decoded
+    {
+      rrlib::serialization::tMemoryBuffer lost_frame;
+      time += cCYCLE_TIME;
+      Encode(encoder, lost_frame, CreateProfiles(handles, ++seed), 2, time);
+    }
+    while (time + cCYCLE_TIME - key_frame_time < std::chrono::seconds(1))
+    {
+      rrlib::serialization::tMemoryBuffer frame;
+      time += cCYCLE_TIME;
+      Encode(encoder, frame, CreateProfiles(handles, ++seed), 2, time);
+      RRLIB_UNIT_TESTS_ASSERT(!Decode(decoder, frame, decoded));
+    }
+
+    // ...until next periodic key frame (one second after the last one)
+    for (int i = 0; i < 3; i++)
+    {
+      rrlib::serialization::tMemoryBuffer frame;
+      time += cCYCLE_TIME;
+      profiles = CreateProfiles(handles, ++seed);
+      Encode(encoder, frame, profiles, 2, time);
+      RRLIB_UNIT_TESTS_ASSERT(Decode(decoder, frame, decoded));
+      AssertEqual(profiles, decoded);
+    }
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestTaskProfileEncoding);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
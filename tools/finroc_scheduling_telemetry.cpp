@@ -0,0 +1,167 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tools/finroc_scheduling_telemetry.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * Command line tool that shows live task profiles of the thread containers
+ * in another process - read from the process' shared memory telemetry segment
+ * (see tTelemetrySegment). Profiling and shared memory telemetry need to be
+ * enabled in the observed process.
+ *
+ * Usage: finroc_scheduling_telemetry <pid> [<refresh interval in ms>]
+ *
+ * For each task, it displays last, average and maximum execution duration.
+ * Jitter is computed from the samples taken during each refresh interval
+ * (standard deviation and range of the last execution durations).
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <thread>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/scheduling/tTelemetrySegment.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace finroc::scheduling;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Statistics on samples of one task during refresh interval */
+struct tSampleStatistics
+{
+  uint64_t count = 0;
+  double sum = 0;
+  double square_sum = 0;
+  int64_t min = 0;
+  int64_t max = 0;
+};
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Interval between two samples */
+const std::chrono::microseconds cSAMPLE_INTERVAL(500);
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+static double ToMicroseconds(double nanoseconds)
+{
+  return nanoseconds / 1000.0;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    fprintf(stderr, "Usage: %s <pid> [<refresh interval in ms>]\n", argv[0]);
+    return 1;
+  }
+  pid_t pid = atoi(argv[1]);
+  std::chrono::milliseconds refresh_interval(argc >= 3 ? atoi(argv[2]) : 1000);
+
+  std::unique_ptr<tTelemetrySegment> segment = tTelemetrySegment::Open(pid);
+  if (!segment)
+  {
+    fprintf(stderr, "Could not open telemetry segment '%s'. Is process running with profiling and shared memory telemetry enabled?\n", tTelemetrySegment::GetSegmentName(pid).c_str());
+    return 1;
+  }
+
+  tTelemetrySegment::tContainerSnapshot snapshots[tTelemetrySegment::cMAX_CONTAINERS];
+  std::map<std::pair<size_t, uint32_t>, tSampleStatistics> statistics;  // key: (slot index, handle)
+  std::vector<uint64_t> last_cycle_count(tTelemetrySegment::cMAX_CONTAINERS, 0);
+  while (true)
+  {
+    // Take samples
+    statistics.clear();
+    auto refresh_time = std::chrono::steady_clock::now() + refresh_interval;
+    while (std::chrono::steady_clock::now() < refresh_time)
+    {
+      for (size_t slot = 0; slot < tTelemetrySegment::cMAX_CONTAINERS; slot++)
+      {
+        if ((!segment->ReadSlot(slot, snapshots[slot])) || snapshots[slot].cycle_count == last_cycle_count[slot])
+        {
+          continue;
+        }
+        last_cycle_count[slot] = snapshots[slot].cycle_count;
+        for (const tTelemetrySegment::tEntry & entry : snapshots[slot].entries)
+        {
+          tSampleStatistics& sample_statistics = statistics[std::make_pair(slot, entry.handle)];
+          int64_t value = entry.last_execution_duration;
+          sample_statistics.min = sample_statistics.count ? std::min(sample_statistics.min, value) : value;
+          sample_statistics.max = sample_statistics.count ? std::max(sample_statistics.max, value) : value;
+          sample_statistics.count++;
+          sample_statistics.sum += value;
+          sample_statistics.square_sum += static_cast<double>(value) * value;
+        }
+      }
+      std::this_thread::sleep_for(cSAMPLE_INTERVAL);
+    }
+
+    // Print
+    printf("\033[2J\033[H%-48s %10s %10s %10s %10s %10s %8s\n", "Task", "Last[us]", "Avg[us]", "Max[us]", "Jitter[us]", "Range[us]", "Samples");
+    for (size_t slot = 0; slot < tTelemetrySegment::cMAX_CONTAINERS; slot++)
+    {
+      if (!segment->ReadSlot(slot, snapshots[slot]))
+      {
+        continue;
+      }
+      for (size_t i = 0; i < snapshots[slot].entries.size(); i++)
+      {
+        const tTelemetrySegment::tEntry& entry = snapshots[slot].entries[i];
+        const tSampleStatistics& sample_statistics = statistics[std::make_pair(slot, entry.handle)];
+        double mean = sample_statistics.count ? sample_statistics.sum / sample_statistics.count : 0;
+        double variance = sample_statistics.count ? std::max(0.0, sample_statistics.square_sum / sample_statistics.count - mean * mean) : 0;
+        printf("%s%-*.*s %10.1f %10.1f %10.1f %10.1f %10.1f %8llu\n", i == 0 ? "" : "  ", i == 0 ? 48 : 46, i == 0 ? 48 : 46, entry.name,
+               ToMicroseconds(entry.last_execution_duration), ToMicroseconds(entry.average_execution_duration), ToMicroseconds(entry.max_execution_duration),
+               ToMicroseconds(std::sqrt(variance)), ToMicroseconds(sample_statistics.max - sample_statistics.min), static_cast<unsigned long long>(sample_statistics.count));
+      }
+    }
+    fflush(stdout);
+  }
+  return 0;
+}
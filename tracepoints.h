@@ -0,0 +1,84 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/scheduling/tracepoints.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * Static user-space tracepoints (USDT - SystemTap SDT style) of scheduling plugin.
+ *
+ * Tracepoints are placed at cycle, task and reschedule boundaries as well as
+ * at watchdog alerts in tThreadContainerThread. They compile to a single 'nop'
+ * instruction and are activated by tracers such as bpftrace or perf at runtime
+ * - without rebuilding or enabling profiling. Example:
+ *
+ *   bpftrace -e 'usdt:<library>:finroc_scheduling:task_end { @[arg1] = hist(arg2); }'
+ *
+ * Provider is 'finroc_scheduling'. Probes and arguments (handles are framework element handles, durations in ns):
+ *
+ *   cycle_start(container_handle, cycle_count)
+ *   cycle_end(container_handle, cycle_count, duration)
+ *   task_start(container_handle, task_handle, task_index)
+ *   task_end(container_handle, task_handle, duration)
+ *   reschedule_start(container_handle)
+ *   reschedule_end(container_handle, task_count, duration)
+ *   watchdog_alert(container_handle, task_handle)
+ *
+ * Durations are zero if thread container does not measure execution durations
+ * (tracers can compute them from probe timestamps in this case).
+ *
+ * If <sys/sdt.h> (package systemtap-sdt-dev) is not available, tracepoints are no-ops.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__scheduling__tracepoints_h__
+#define __plugins__scheduling__tracepoints_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define FINROC_SCHEDULING_TRACEPOINTS_AVAILABLE
+#endif
+#endif
+
+//----------------------------------------------------------------------
+// Tracepoint macros
+//----------------------------------------------------------------------
+#ifdef FINROC_SCHEDULING_TRACEPOINTS_AVAILABLE
+
+#define FINROC_SCHEDULING_TRACEPOINT1(name, arg1) DTRACE_PROBE1(finroc_scheduling, name, arg1)
+#define FINROC_SCHEDULING_TRACEPOINT2(name, arg1, arg2) DTRACE_PROBE2(finroc_scheduling, name, arg1, arg2)
+#define FINROC_SCHEDULING_TRACEPOINT3(name, arg1, arg2, arg3) DTRACE_PROBE3(finroc_scheduling, name, arg1, arg2, arg3)
+
+#else
+
+#define FINROC_SCHEDULING_TRACEPOINT1(name, arg1)
+#define FINROC_SCHEDULING_TRACEPOINT2(name, arg1, arg2)
+#define FINROC_SCHEDULING_TRACEPOINT3(name, arg1, arg2, arg3)
+
+#endif
+
+#endif